@@ -0,0 +1,75 @@
+#pragma once
+#include "Search.hpp"
+#include "../Utilities/SPSCQueue.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace engine
+{
+    struct AnalysisUpdate
+    {
+        uint64_t m_positionHash = 0; // Position the result is for
+        SearchResult m_result;
+        bool m_isFinal = false; // The search is over, no more updates will follow
+    };
+
+    // Runs Search on a background thread so that the thread asking for the
+    // analysis, typically the game loop, never waits for it. Every completed
+    // iteration is published through a lock-free queue, to be polled.
+    //
+    // Starting a new analysis cancels the previous one, whose remaining
+    // updates are then skipped by pollUpdate. analyse, cancel and pollUpdate
+    // are to be called from one and the same thread.
+    class AnalysisWorker
+    {
+    public:
+        explicit AnalysisWorker(unsigned threadCount_ = 1, size_t hashEntries_ = g_DEFAULT_HASH_ENTRIES);
+        ~AnalysisWorker();
+
+        AnalysisWorker(const AnalysisWorker&) = delete;
+        AnalysisWorker& operator=(const AnalysisWorker&) = delete;
+
+        // The default limits analyse until cancelled
+        void analyse(const Position&, const SearchLimits& = SearchLimits(), std::vector<uint64_t> history_ = {});
+        void cancel();
+
+        // Next update of the current analysis, if one is available
+        bool pollUpdate(AnalysisUpdate&);
+
+    private:
+        // Enough for every iteration of a search, so that updates are never
+        // dropped as long as the queue is drained between analyses
+        static constexpr size_t g_QUEUE_CAPACITY = 256;
+
+        struct Request
+        {
+            Position m_position;
+            SearchLimits m_limits;
+            std::vector<uint64_t> m_history;
+            uint64_t m_generation = 0;
+        };
+
+        struct QueuedUpdate
+        {
+            uint64_t m_generation = 0;
+            AnalysisUpdate m_update;
+        };
+
+        Search m_search;
+        SPSCQueue<QueuedUpdate, g_QUEUE_CAPACITY> m_updates;
+        std::atomic<uint64_t> m_generation{0}; // Bumped by every analyse and cancel
+
+        std::mutex m_mutex;
+        std::condition_variable m_requestAvailable;
+        Request m_request;
+        bool m_hasRequest = false;
+        bool m_quit = false;
+
+        std::thread m_thread; // Started last, once everything above is constructed
+
+        void run();
+        bool isCurrent(uint64_t generation_) const { return generation_ == m_generation.load(std::memory_order_acquire); }
+    };
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "../Logic/Position.hpp"
+
+// Static evaluation used by the search: material plus piece-square tables
+// (the Chess Programming Wiki "Simplified Evaluation Function"), with the
+// king table blended from middlegame to endgame as pieces come off.
+namespace engine
+{
+    // Centipawns, in PieceType order. The king is never traded, so it is worth nothing here.
+    inline constexpr int g_PIECE_VALUES[g_NUMBER_OF_PIECE_TYPES] = {100, 500, 320, 330, 0, 900};
+
+    inline int getPieceValue(PieceType type_) { return g_PIECE_VALUES[pieceTypeIndex(type_)]; }
+
+    // Centipawns, positive when the side to move is better
+    int evaluate(const Position&);
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include "../Logic/Position.hpp"
+#include "../Logic/CompactMove.hpp"
+#include "../Logic/TranspositionTable.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace engine
+{
+    inline constexpr int g_INFINITE_SCORE = 32000;
+    inline constexpr int g_MATE_SCORE = 31000; // Being mated now, mate in n plies scores g_MATE_SCORE - n
+    inline constexpr int g_MAX_PLY = 128;
+    inline constexpr size_t g_DEFAULT_HASH_ENTRIES = 1 << 20; // 24 MB
+
+    inline bool isMateScore(int score_) { return std::abs(score_) >= g_MATE_SCORE - g_MAX_PLY; }
+
+    // The search ends on whichever limit is reached first. Zero nodes or
+    // time means no such limit.
+    struct SearchLimits
+    {
+        int m_depth = g_MAX_PLY - 1;
+        uint64_t m_nodes = 0;
+        std::chrono::milliseconds m_time{0};
+    };
+
+    struct SearchResult
+    {
+        CompactMove m_bestMove; // Null when there is no legal move
+        int m_score = 0; // Centipawns for the side to move, see isMateScore
+        int m_depth = 0; // Last completed iteration
+        uint64_t m_nodes = 0;
+        std::chrono::milliseconds m_time{0};
+        std::vector<CompactMove> m_principalVariation; // Starts with the best move
+    };
+
+    // Called after every completed iteration
+    typedef std::function<void(const SearchResult&)> IterationCallback;
+
+    // What the search learnt about a position, kept in the transposition table
+    struct TranspositionEntry
+    {
+        CompactMove m_move;
+        int16_t m_score;
+        int8_t m_depth;
+        uint8_t m_bound;
+    };
+
+    typedef TranspositionTable<TranspositionEntry> SearchTable;
+
+    // In-process engine built on MoveGenerator: iterative deepening negamax
+    // with alpha-beta pruning, principal variation search, a transposition
+    // table and quiescence search on captures and promotions. Moves are
+    // tried hash move first, then captures by most valuable victim, then
+    // killer moves and history.
+    //
+    // Several threads search in the Lazy SMP way: each runs the same
+    // iterative deepening on its own, and they only cooperate through the
+    // shared transposition table. The calling thread is the main one; it
+    // alone checks the limits and reports iterations, and its result is
+    // returned. With a single thread, the default, the search is
+    // deterministic.
+    class Search
+    {
+    public:
+        explicit Search(size_t hashEntries_ = g_DEFAULT_HASH_ENTRIES, unsigned threadCount_ = 1);
+        ~Search();
+
+        // Not to be called during run()
+        void setThreadCount(unsigned threadCount_);
+        unsigned getThreadCount() const { return static_cast<unsigned>(m_workers.size()); }
+
+        // history_ holds the hashes of the positions played before this one,
+        // so that repetitions are scored as draws
+        SearchResult run(const Position&, const SearchLimits&,
+                         const std::vector<uint64_t>& history_ = {}, const IterationCallback& = nullptr);
+
+        // Safe to call from another thread. run() then returns the result of
+        // the last completed iteration. The node count of the result covers
+        // every thread.
+        void stop() { m_stopRequested = true; }
+
+        // Forgets what earlier searches learnt, e.g. before a new game
+        void clear();
+
+    private:
+        class Worker;
+
+        SearchTable m_table;
+        std::vector<std::unique_ptr<Worker>> m_workers; // The main worker comes first
+        std::atomic<bool> m_stopRequested{false};
+
+        uint64_t countNodes() const;
+    };
+}
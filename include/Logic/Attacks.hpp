@@ -0,0 +1,78 @@
+#pragma once
+#include "Bitboard.hpp"
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+// Precomputed attack tables. The leaper tables (knight, king, pawn) are
+// indexed by square only; the sliding pieces use magic bitboards. All tables
+// are filled once at program startup (see Attacks.cpp). When the compiler targets BMI2
+// (e.g. -mbmi2 or -march=native) the table index is computed with PEXT,
+// otherwise the portable magic multiplication is used.
+namespace attacks
+{
+    struct Magic
+    {
+        Bitboard m_mask; // Relevant occupancy, edges excluded
+        Bitboard m_magic; // Unused with PEXT indexing
+        const Bitboard* m_attacks; // Slice of the shared attack table
+        unsigned m_shift;
+
+        unsigned getIndex(Bitboard occupancy_) const
+        {
+#if defined(__BMI2__)
+            return static_cast<unsigned>(_pext_u64(occupancy_, m_mask));
+#else
+            return static_cast<unsigned>(((occupancy_ & m_mask) * m_magic) >> m_shift);
+#endif
+        }
+    };
+
+    extern Magic g_rookMagics[bitboard::g_NUMBER_OF_SQUARES];
+    extern Magic g_bishopMagics[bitboard::g_NUMBER_OF_SQUARES];
+    extern Bitboard g_knightAttacks[bitboard::g_NUMBER_OF_SQUARES];
+    extern Bitboard g_kingAttacks[bitboard::g_NUMBER_OF_SQUARES];
+    extern Bitboard g_pawnAttacks[2][bitboard::g_NUMBER_OF_SQUARES]; // [team index][square]
+
+    extern Bitboard g_between[bitboard::g_NUMBER_OF_SQUARES][bitboard::g_NUMBER_OF_SQUARES];
+    extern Bitboard g_line[bitboard::g_NUMBER_OF_SQUARES][bitboard::g_NUMBER_OF_SQUARES];
+
+    inline Bitboard getKnightAttacks(int square_) { return g_knightAttacks[square_]; }
+    inline Bitboard getKingAttacks(int square_) { return g_kingAttacks[square_]; }
+
+    // Squares attacked by a pawn of the given team index (0 == white, moving towards rank 8)
+    inline Bitboard getPawnAttacks(int teamIndex_, int square_) { return g_pawnAttacks[teamIndex_][square_]; }
+
+    inline Bitboard getRookAttacks(int square_, Bitboard occupancy_)
+    {
+        const Magic& magic = g_rookMagics[square_];
+        return magic.m_attacks[magic.getIndex(occupancy_)];
+    }
+
+    inline Bitboard getBishopAttacks(int square_, Bitboard occupancy_)
+    {
+        const Magic& magic = g_bishopMagics[square_];
+        return magic.m_attacks[magic.getIndex(occupancy_)];
+    }
+
+    inline Bitboard getQueenAttacks(int square_, Bitboard occupancy_)
+    {
+        return getRookAttacks(square_, occupancy_) | getBishopAttacks(square_, occupancy_);
+    }
+
+    // Squares strictly between two squares sharing a rank, file or diagonal,
+    // empty otherwise
+    inline Bitboard getBetween(int from_, int to_) { return g_between[from_][to_]; }
+
+    // Whole rank, file or diagonal through two squares, empty if they are not aligned
+    inline Bitboard getLine(int from_, int to_) { return g_line[from_][to_]; }
+
+    // Reference implementations walking each ray square by square. They are
+    // used to fill the tables and to validate them.
+    Bitboard getRookAttacksByRayWalk(int square_, Bitboard occupancy_);
+    Bitboard getBishopAttacksByRayWalk(int square_, Bitboard occupancy_);
+
+    // Compares the table lookups against the ray walkers for random occupancies.
+    bool selfCheck(int occupanciesPerSquare_ = 64);
+}
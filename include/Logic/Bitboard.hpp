@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+// One bit per square. Squares follow the tile grid orientation used
+// everywhere else in the project: square = rank * 8 + file, so that
+// square 0 is a8 and square 63 is h1.
+typedef uint64_t Bitboard;
+
+namespace bitboard
+{
+    inline constexpr int g_NUMBER_OF_SQUARES = 64;
+    inline constexpr int g_NO_SQUARE = -1;
+
+    inline constexpr Bitboard g_EMPTY = 0ULL;
+    inline constexpr Bitboard g_FILE_A = 0x0101010101010101ULL;
+    inline constexpr Bitboard g_FILE_H = g_FILE_A << 7;
+    inline constexpr Bitboard g_RANK_8 = 0xFFULL; // Grid rank 0
+    inline constexpr Bitboard g_RANK_1 = g_RANK_8 << 56; // Grid rank 7
+
+    constexpr int toSquare(int file_, int rank_) { return rank_ * 8 + file_; }
+    constexpr int getFile(int square_) { return square_ & 7; }
+    constexpr int getRank(int square_) { return square_ >> 3; }
+    constexpr Bitboard squareMask(int square_) { return 1ULL << square_; }
+    constexpr bool isSet(Bitboard bitboard_, int square_) { return (bitboard_ >> square_) & 1ULL; }
+
+    inline int popCount(Bitboard bitboard_) { return __builtin_popcountll(bitboard_); }
+    inline int lsb(Bitboard bitboard_) { return __builtin_ctzll(bitboard_); }
+
+    // Returns the least significant square and clears it from the bitboard
+    inline int popLsb(Bitboard& bitboard_)
+    {
+        const int square = lsb(bitboard_);
+        bitboard_ &= bitboard_ - 1;
+        return square;
+    }
+}
@@ -1,20 +1,32 @@
 #pragma once
 #include "Pieces/Piece.hpp"
 #include "Move.hpp"
+#include "Position.hpp"
+#include "MoveList.hpp"
 
 #include <list>
 #include <optional>
 #include <memory>
+#include <string>
+#include <string_view>
 
 class King;
 class Move;
 enum class Team;
 
+// Owns the pieces displayed by the UI and keeps a bitboard Position in sync
+// with them. The tile API is kept for the UI, while move generation and check
+// detection read the bitboards.
 class Board
 {
 public:
     Board(); // user-defined default constructor
-    explicit Board(const std::string&);
+    explicit Board(const std::string&); // The FEN must pass checkFEN
+
+    // What keeps fen_ from being set up, or an empty string if nothing does:
+    // the layout, material promotions could not give, and the side not to
+    // move in check. Positions passing it are not all reachable.
+    static std::string checkFEN(std::string_view fen_);
     
     void reset();
 
@@ -24,8 +36,10 @@ public:
     std::shared_ptr<Piece>& getBoardTile(int file_, int row_) { return m_board[row_][file_]; }
     std::shared_ptr<Piece>& getBoardTile(const std::pair<char, int>&);
     const std::shared_ptr<King>& getKing() const;
-    Team getTurn() const { return m_turn; }
-    void setTurn(Team turn_) { m_turn = turn_; }
+    const Position& getPosition() const { return m_position; }
+    uint64_t hash() const; // Zobrist hash of the position, maintained incrementally
+    Team getTurn() const { return m_position.getTurn(); }
+    void setTurn(Team turn_) { m_position.setTurn(turn_); }
     void setIsKingChecked(bool isKingChecked_) { m_isKingChecked = isKingChecked_; }
     void setBoardTile(int, int, std::shared_ptr<Piece>&, bool = true);
     void resetBoardTile(int, int, bool = true);
@@ -35,14 +49,15 @@ public:
 
     // Utility functions
     std::shared_ptr<Move> applyMoveOnBoard(MoveType, coor2d, coor2d, const std::shared_ptr<Piece>&, const std::vector<Arrow>&);
-    std::shared_ptr<Move> applyMoveOnBoardTesting(MoveType, coor2d, coor2d, const std::shared_ptr<Piece>&);    
+    std::shared_ptr<Move> applyMoveOnBoardTesting(MoveType, coor2d, coor2d, const std::shared_ptr<Piece>&, PieceType promotion_ = PieceType::QUEEN);
     void updateBoardInfosAfterNewMove(const std::shared_ptr<Piece>&, const std::shared_ptr<Move>&);
     void printBoard() const;
 
 
     std::optional<Move> findSelectedMove(const std::shared_ptr<Piece>&, int, int) const;
+    Move toMove(CompactMove) const;
     std::vector<Move> possibleMovesFor(const std::shared_ptr<Piece>&);
-    const std::vector<Move>& getAllCurrentlyAvailableMoves() const { return m_allCurrentlyAvailableMoves; }
+    const MoveList& getAllCurrentlyAvailableMoves() const { return m_allCurrentlyAvailableMoves; }
     void updateAllCurrentlyAvailableMoves();
     void switchTurn();
     bool kingIsChecked();
@@ -57,17 +72,21 @@ public:
 
 private:
     std::shared_ptr<Piece> m_board[8][8];
-    Team m_turn; // White or black player's turn
+    Position m_position; // Bitboard mirror of m_board, also holds the player's turn
     std::vector<std::shared_ptr<Piece>> m_whitePieces;
     std::vector<std::shared_ptr<Piece>> m_blackPieces;
     std::shared_ptr<King> m_whiteKing;
     std::shared_ptr<King> m_blackKing;
     bool m_isFlipped = false;
-    std::vector<Move> m_allCurrentlyAvailableMoves;
+    MoveList m_allCurrentlyAvailableMoves;
     bool m_isKingChecked = false;
     bool m_currentlyNoMovesAvailable = false;
 
     std::shared_ptr<Piece> m_pLastMovedPiece;
 
-    void removeIllegalMoves(std::vector<Move>&, std::shared_ptr<Piece>&);
+    void syncPositionWithBoardTiles();
+    void syncCastlingRightsAndEnPassant();
+    void applyFENCastlingRights(const std::string&);
+    void applyFENEnPassantSquare(const std::string&);
+    bool hasCastlingRight(const std::shared_ptr<King>&, int) const;
 };
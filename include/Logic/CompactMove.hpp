@@ -0,0 +1,52 @@
+#pragma once
+#include "Move.hpp"
+#include "Bitboard.hpp"
+#include "Pieces/Piece.hpp"
+
+#include <cstdint>
+#include <iostream>
+
+// Move packed into 16 bits, used for generation and search. Unlike Move it
+// holds no piece pointers, so it is trivially copyable and costs nothing to
+// discard. The rich Move is only built when a move is committed (see
+// Board::toMove).
+//
+// Layout: bits 0-5 origin square, bits 6-11 destination square, bits 12-15
+// kind. The kind is the MoveType, except that promotions get one kind per
+// promoted piece. Squares follow Bitboard.hpp (square 0 == a8).
+class CompactMove
+{
+public:
+    CompactMove() = default;
+    CompactMove(int from_, int to_, MoveType type_, PieceType promotion_ = PieceType::QUEEN):
+        m_data(static_cast<uint16_t>(from_ | (to_ << 6) | (toKind(type_, promotion_) << 12)))
+    {
+    }
+
+    // Getters
+    int getFrom() const { return m_data & 0x3F; }
+    int getTo() const { return (m_data >> 6) & 0x3F; }
+    MoveType getMoveType() const { return (getKind() >= g_UNDERPROMOTION_KIND)? MoveType::NEWPIECE: static_cast<MoveType>(getKind()); }
+    PieceType getPromotion() const; // Only meaningful for NEWPIECE moves
+    coor2d getInit() const { return {bitboard::getFile(getFrom()), bitboard::getRank(getFrom())}; }
+    coor2d getTarget() const { return {bitboard::getFile(getTo()), bitboard::getRank(getTo())}; }
+    bool isNull() const { return m_data == 0; }
+
+    bool operator==(CompactMove other_) const { return m_data == other_.m_data; }
+    bool operator!=(CompactMove other_) const { return m_data != other_.m_data; }
+
+private:
+    // Kinds 7 to 9 are promotions to rook, bishop and knight. NEWPIECE itself
+    // stands for the promotion to a queen.
+    inline static constexpr int g_UNDERPROMOTION_KIND = 7;
+
+    uint16_t m_data = 0; // a8a8, never a real move
+
+    int getKind() const { return m_data >> 12; }
+    static int toKind(MoveType, PieceType);
+};
+
+static_assert(sizeof(CompactMove) == 2, "CompactMove must stay packed into 16 bits");
+
+// Long algebraic notation, e.g. "e2e4" or "e7e8n"
+std::ostream& operator<<(std::ostream&, CompactMove);
@@ -12,6 +12,7 @@ class Piece;
 class Board;
 
 enum class MoveType { NORMAL, CASTLE_KINGSIDE, CASTLE_QUEENSIDE, ENPASSANT, NEWPIECE, CAPTURE, INIT_SPECIAL };
+enum class PieceType { PAWN, ROOK, KNIGHT, BISHOP, KING, QUEEN };
 
 typedef std::pair<int, char> coor2dChar;
 
@@ -27,6 +28,7 @@ public:
 
     const std::vector<Arrow>& getMoveArrows() { return m_arrows; }
     MoveType getMoveType() const { return m_MoveType; }
+    PieceType getPromotion() const { return m_promotion; } // Only meaningful for NEWPIECE moves
     const std::shared_ptr<Piece>& getSelectedPiece() const { return m_selectedPiece; }
     std::shared_ptr<Piece>& getSelectedPiece() { return m_selectedPiece; }
 
@@ -45,6 +47,7 @@ public:
     void setNoMovesAvailable(bool noMoves_ = true) { m_noMovesAvailable = noMoves_; }
     void setTarget(const coor2d& target_) { m_target = target_; }
     void setMoveType(MoveType moveType_) { m_MoveType = moveType_; }
+    void setPromotion(PieceType promotion_) { m_promotion = promotion_; }
     void setCapturedPiece(const std::shared_ptr<Piece>& capturedPiece_) { m_capturedPiece = capturedPiece_; }
     void setSelectedPiece(const std::shared_ptr<Piece>& piece_) { m_selectedPiece = piece_; }
     void setMoveArrows(const std::vector<Arrow> arrows_) { m_arrows = arrows_; }
@@ -56,6 +59,7 @@ private:
     std::shared_ptr<Piece> m_selectedPiece; // Piece that is being selected
     std::shared_ptr<Piece> m_capturedPiece; // Captured piece, the moved rook in castling, or taken pawn in en passant
     MoveType m_MoveType = MoveType::CAPTURE; // Move type
+    PieceType m_promotion = PieceType::QUEEN; // Piece a pawn becomes on NEWPIECE moves
     coor2d m_target = {0, 0}; // Destination square of the piece that is being moved
     coor2d m_init = {0, 0}; // Initial square of the piece moved
     std::optional<coor2d> m_enPassantInitialPos; // En passant information
@@ -65,7 +69,9 @@ private:
 };
 
 std::pair<char, int> findLetterCoord(const coor2d& target_);
+std::string parseMoveNumber(int moveNumber_, bool showNumber_, bool showDots_); // "12.", "11..." or nothing
 std::string parseMoveHelper(const Move& move_, int moveNumber_, bool showNumber_, bool showDots_);
 std::string parseMove(const Move& move_, int moveNumber_, bool showNumber_, bool showDots_ = false);
+std::string toLongAlgebraic(const Move& move_); // e.g. "e2e4", "e7e8q", as used by UCI
 
 std::ostream& operator<<(std::ostream&, const Move&);
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "Position.hpp"
+#include "MoveList.hpp"
+
+// Generates the legal moves of the side to move of a Position. Checkers and
+// pinned pieces are computed once on construction, so that every move can be
+// emitted directly without playing it on a board first.
+class MoveGenerator
+{
+public:
+    explicit MoveGenerator(const Position&);
+
+    // Moves are grouped by origin square, in ascending square order. Each
+    // promotion is emitted once per piece, the queen first.
+    void generateLegalMoves(MoveList&) const;
+
+    // Getters
+    Bitboard getCheckers() const { return m_checkers; }
+    Bitboard getPinnedPieces() const { return m_pinned; }
+    bool isInCheck() const { return m_checkers != bitboard::g_EMPTY; }
+
+private:
+    const Position& m_position;
+    Team m_us;
+    Team m_them;
+    int m_kingSquare;
+    Bitboard m_checkers = bitboard::g_EMPTY; // Enemy pieces giving check
+    Bitboard m_pinned = bitboard::g_EMPTY; // Own pieces pinned against the king
+    Bitboard m_checkMask = ~bitboard::g_EMPTY; // Squares that resolve a single check
+
+    void addPawnMoves(int, MoveList&) const;
+    void addKingMoves(MoveList&) const;
+    void addCastlingMoves(MoveList&) const;
+    void addTargets(int, Bitboard, MoveList&) const;
+    void addPawnMove(int, int, MoveType, MoveList&) const;
+    Bitboard getPinRay(int) const;
+    bool isEnPassantLegal(int, int) const;
+};
@@ -0,0 +1,40 @@
+#pragma once
+#include "CompactMove.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+// Most legal moves known in any reachable position
+inline constexpr size_t g_MAX_LEGAL_MOVES = 218;
+
+// Fixed-capacity list of the moves of one position. The storage is inline,
+// so filling a list never touches the heap. It offers the subset of the
+// std::vector interface used by the move generator and its callers.
+class MoveList
+{
+public:
+    typedef CompactMove value_type;
+    typedef const CompactMove* const_iterator;
+
+    void push_back(CompactMove move_)
+    {
+        assert(m_size < g_MAX_LEGAL_MOVES);
+        m_moves[m_size++] = move_;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args_) { push_back(CompactMove(std::forward<Args>(args_)...)); }
+
+    void clear() { m_size = 0; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    CompactMove operator[](size_t index_) const { return m_moves[index_]; }
+    const_iterator begin() const { return m_moves.data(); }
+    const_iterator end() const { return m_moves.data() + m_size; }
+
+private:
+    std::array<CompactMove, g_MAX_LEGAL_MOVES> m_moves;
+    size_t m_size = 0;
+};
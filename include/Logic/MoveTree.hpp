@@ -2,189 +2,182 @@
 #include "MoveTreeNode.hpp"
 
 using namespace std;
+#include <deque>
 #include <iostream>
 #include <sstream>
-
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// The moves of a game with all its variations.
+//
+// Nodes live in one contiguous arena and refer to each other by index, with
+// the move of each node in a parallel array and the annotations, which few
+// nodes have, in a map. The root is the first node and holds no move. Nodes
+// are never freed one by one: clear drops the whole arena at once, while a
+// deleted variation is only unlinked from the tree.
+//
+// Each node also keeps its depth and its index among its siblings, so the
+// questions asked for every move on display take constant time.
+//
+// The notation of each move is worked out once, when the move is committed
+// (see MoveTreeManager::addMove), and kept in a pool of strings where moves
+// that read the same share one copy. The pool outlives clear, as games have
+// most of their moves in common.
 class MoveTree
 {
 public:
-    shared_ptr<MoveTreeNode> m_root = make_shared<MoveTreeNode>(); // Root of the tree
-    int numberOfMoves = 0;
+    inline static constexpr NodeIndex g_ROOT = 0;
 
-    shared_ptr<MoveTreeNode> getRoot() const { return m_root; }
+    MoveTree();
 
+    // Position in a tree, as a node index. Stays valid as nodes are added.
     class Iterator
     {
-        shared_ptr<MoveTreeNode> m_ptr;
+        friend class MoveTree;
+
+        const MoveTree* m_pTree = nullptr;
+        NodeIndex m_index = g_NO_NODE;
 
     public:
         using iterator_category = bidirectional_iterator_tag;
         using difference_type = ptrdiff_t;
 
-        explicit Iterator(const shared_ptr<MoveTreeNode>& ptr): m_ptr(ptr) {}
+        Iterator(const MoveTree& tree_, NodeIndex index_): m_pTree(&tree_), m_index(index_) {}
         Iterator() = default;
 
-        MoveTreeNode& operator*() const { return *m_ptr; }
-        shared_ptr<MoveTreeNode>& operator->() { return m_ptr; }
-        shared_ptr<MoveTreeNode>& get() { return m_ptr; }
-
-        bool isAtTheBeginning() const 
-        {
-            return !m_ptr->m_parent;
-        }
-
-        bool isAtTheEnd() const 
-        {
-            return m_ptr->m_children.empty();
-        }
-
-        void reset() 
-        {
-            while (!isAtTheBeginning()) m_ptr = m_ptr->m_parent;
-        }
+        const MoveTreeNode& operator*() const { return m_pTree->getNode(m_index); }
+        const MoveTreeNode* operator->() const { return &m_pTree->getNode(m_index); }
 
-        bool currentNodeHasMoreThanOneVariation()
-        {
-            return m_ptr->m_children.size() > 1;
-        }
+        NodeIndex getIndex() const { return m_index; }
+        const shared_ptr<Move>& getMove() const { return m_pTree->getMove(m_index); } // Null at the root
+        std::string_view getSAN() const { return m_pTree->getSAN(m_index); }
+        int getChildCount() const { return (*this)->m_childCount; }
 
-        const shared_ptr<MoveTreeNode>& getCurrentNode()
-        {
-            return m_ptr;
-        }
-
-        void goToChild(int i) { m_ptr = m_ptr->m_children.at(i); }
+        bool isAtTheBeginning() const { return (*this)->m_parent == g_NO_NODE; }
+        bool isAtTheEnd() const { return (*this)->m_firstChild == g_NO_NODE; }
+        void reset() { m_index = g_ROOT; }
+        bool currentNodeHasMoreThanOneVariation() const { return getChildCount() > 1; }
 
-        void addChild(shared_ptr<MoveTreeNode>& child)
-        {
-            if (!m_ptr)
-            {
-                m_ptr = child;
-            }
-            else
-            {
-                m_ptr->m_children.push_back(child);
-                child->m_parent = m_ptr;
-                ++(m_ptr->childNumber);
-                goToChild(m_ptr->childNumber-1);
-            }
-        }
+        void goToChild(int i) { m_index = m_pTree->getChild(m_index, i); }
 
-        bool goToParent() 
+        bool goToParent()
         {
-            shared_ptr<MoveTreeNode> parent = m_ptr->m_parent;
-            if (parent) {
-                m_ptr = parent;
-                return true;
-            }
-            return false;
+            if (isAtTheBeginning()) return false;
+            m_index = (*this)->m_parent;
+            return true;
         }
 
         bool goToGrandChild(int i)
         {
-            auto temp = m_ptr;   
-            if (temp->m_children.size() <= i) return false;
-            temp = temp->m_children.at(i);
-            if (temp->m_children.size() <= i) return false;
-            temp = temp->m_children.at(i);
-
-            m_ptr = temp;
+            if (getChildCount() <= i) return false;
+            const NodeIndex child = m_pTree->getChild(m_index, i);
+            if (m_pTree->getNode(child).m_childCount <= i) return false;
+            m_index = m_pTree->getChild(child, i);
             return true;
         }
 
-        int getNodeLevel() 
-        {
-            shared_ptr<MoveTreeNode> temp = m_ptr;
-            int i = 0;
-            while (temp->m_parent)
-            {
-                temp = temp->m_parent;
-                ++i;
-            }
-            return i;
-        }
+        int getNodeLevel() const { return (*this)->m_depth; }
 
-        int getNodeIdxAmongSiblings() 
+        int getNodeIdxAmongSiblings() const
         {
-            auto temp = m_ptr;
-            if (!temp) return -1;
-
-            auto parent = temp->m_parent;
-            
-            if (!parent) return -1;
-            
-            for (size_t i = 0; i < parent->m_children.size(); ++i) 
-            {
-                if (parent->m_children.at(i) == temp) return i;
-            }
-            
-            // Index not found
-            return -1;
+            if (isAtTheBeginning()) return -1;
+            return (*this)->m_siblingIndex;
         }
 
-        int getNbOfNodesAtCurrentLevel()
+        int getNbOfNodesAtCurrentLevel() const
         {
-            if (!m_ptr || !m_ptr->m_parent) return 1;
-            return m_ptr->m_parent->m_children.size();
+            if (isAtTheBeginning()) return 1;
+            return m_pTree->getNode((*this)->m_parent).m_childCount;
         }
 
         // Prefix increment
-        shared_ptr<MoveTreeNode> operator++()
-        {
-            goToChild(0); return m_ptr;
-        }
+        Iterator& operator++() { goToChild(0); return *this; }
 
         // Postfix increment
-        shared_ptr<MoveTreeNode> operator++(int)
-        {
-            shared_ptr<MoveTreeNode> res = m_ptr; goToChild(0); return res;
-        }
+        Iterator operator++(int) { Iterator res = *this; goToChild(0); return res; }
 
-        // Shift child number
-        shared_ptr<MoveTreeNode> operator>>(int n)
+        // Shift to a later sibling
+        Iterator& operator>>(int n)
         {
-            if (!m_ptr) return m_ptr; // we're at the root - no siblings here
-            int childNumber = m_ptr->childNumber;
-            goToChild(childNumber+n);
-            return m_ptr;
+            if (isAtTheBeginning()) return *this; // we're at the root - no siblings here
+            m_index = m_pTree->getChild((*this)->m_parent, getNodeIdxAmongSiblings() + n);
+            return *this;
         }
 
-        // Shift child number
-        shared_ptr<MoveTreeNode> operator<<(int n)
-        {
-            if (!m_ptr) return m_ptr; // we're at the root - no siblings here
-            int childNumber = m_ptr->childNumber;
-            goToChild(childNumber-n);
-            return m_ptr;
-        }
+        // Shift to an earlier sibling
+        Iterator& operator<<(int n) { return *this >> -n; }
 
         // Prefix decrement
-        shared_ptr<MoveTreeNode> operator--() { goToParent(); return m_ptr; }
+        Iterator& operator--() { goToParent(); return *this; }
 
         // Postfix decrement
-        shared_ptr<MoveTreeNode> operator--(int) { shared_ptr<MoveTreeNode> res = m_ptr; goToParent(); return res; }
+        Iterator operator--(int) { Iterator res = *this; goToParent(); return res; }
 
         friend bool operator ==(const Iterator& a, const Iterator& b) {
-            return a.m_ptr == b.m_ptr;
+            return a.m_pTree == b.m_pTree && a.m_index == b.m_index;
         };
         friend bool operator !=(const Iterator& a, const Iterator& b) {
-            return a.m_ptr != b.m_ptr;
+            return !(a == b);
         };
     };
 
-    Iterator begin() const { return Iterator(getRoot()); }
+    Iterator begin() const { return Iterator(*this, g_ROOT); }
+
+    const MoveTreeNode& getNode(NodeIndex node_) const { return m_nodes[node_]; }
+    const shared_ptr<Move>& getMove(NodeIndex node_) const { return m_moves[node_]; }
+    NodeIndex getChild(NodeIndex, int) const;
+
+    // Standard algebraic notation of the move, empty if it was never set
+    std::string_view getSAN(NodeIndex) const;
+    void setSAN(NodeIndex, std::string_view);
+
+    // Null if the move has no annotation
+    const MoveAnnotation* getAnnotation(NodeIndex) const;
+    MoveAnnotation& annotate(NodeIndex);
 
     void insertNode(const shared_ptr<Move>&, MoveTree::Iterator&);
+
+    // Makes the variation starting at the iterator the main line of its parent
+    void promoteVariation(const MoveTree::Iterator&);
+
+    // Removes the node at the iterator with all the moves after it, then
+    // moves the iterator to the parent. Other iterators must not point into
+    // the removed variation.
+    void deleteVariation(MoveTree::Iterator&);
+
     void goToNextNode(int, MoveTree::Iterator&);
     void goToPreviousNode(MoveTree::Iterator&);
     void printTree(std::ostream& os_ = std::cout) const;
     std::string printTreeGet() const;
-    void printTreeRec(shared_ptr<MoveTreeNode>&, vector<bool>, std::ostream& os_, int a = 0, bool b = false) const;
-    int getNumberOfMoves() const { return numberOfMoves; }
-    void printPreorder(shared_ptr<MoveTreeNode>&);
-    int getNodeLevel(MoveTree::Iterator&);
-    void clear() {
-        m_root = make_shared<MoveTreeNode>();
-        numberOfMoves = 0;
-    }
+    int getNumberOfMoves() const { return m_numberOfMoves; }
+
+    // New nodes always go at the end of the arena, in the order they were
+    // inserted, so a view of the tree can catch up from the arena size it
+    // last saw, unless the edit count changed in between: edits are the
+    // changes that do more than add nodes (promotions, deletions, clears).
+    size_t getArenaSize() const { return m_nodes.size(); }
+    size_t getEditCount() const { return m_editCount; }
+    void printPreorder(NodeIndex = g_ROOT) const;
+    int getNodeLevel(const MoveTree::Iterator& it_) const { return it_.getNodeLevel(); }
+    void clear();
+
+private:
+    vector<MoveTreeNode> m_nodes;
+    vector<shared_ptr<Move>> m_moves; // Of each node
+    unordered_map<NodeIndex, MoveAnnotation> m_annotations;
+    int m_numberOfMoves = 0; // Nodes in the tree, without the root
+    size_t m_editCount = 0;
+    deque<string> m_strings; // Never moved, for the views of m_stringIds
+    unordered_map<std::string_view, uint32_t> m_stringIds;
+
+    NodeIndex addNode(NodeIndex parent_, const shared_ptr<Move>&);
+    void unlinkNode(NodeIndex);
+    void renumberChildren(NodeIndex parent_);
+    uint32_t intern(std::string_view);
+    void printTreeRec(NodeIndex, vector<bool>, std::ostream& os_, int a = 0, bool b = false) const;
 };
+
+// The notation of the move at it_, for display: from the tree when it is
+// known, else worked out from the move alone (see parseMove for a Move)
+std::string parseMove(const MoveTree::Iterator& it_, int moveNumber_, bool showNumber_, bool showDots_ = false);
@@ -10,6 +10,7 @@ struct MoveInfo
     int m_indentLevel = 0;
     // bool m_isInlineSubVariation = false;  -- TODO in the future 
     Move* m_movePtr = nullptr;
+    NodeIndex m_node = g_NO_NODE;
     std::optional<std::string> m_letterPrefix = std::nullopt;
 };
 
@@ -19,11 +20,29 @@ public:
     explicit MoveTreeDisplayHandler(const MoveTree& tree_);
     MoveTreeDisplayHandler() = default;
 
-    std::vector<MoveInfo> generateMoveInfo();
+    // Brought up to date with the tree, which is only done when the tree
+    // changed. Moves that extend the last line laid out are appended to it,
+    // anything else lays the whole tree out again.
+    const std::vector<MoveInfo>& generateMoveInfo();
+
+    // Changes whenever the move infos do
+    size_t getRevision() const { return m_revision; }
+
+    // Changes whenever the move infos are laid out again; in between, moves
+    // are only appended
+    size_t getRebuildCount() const { return m_rebuildCount; }
 
 private:
     const MoveTree& m_tree;
     std::vector<MoveInfo> m_moveInfos;
+    bool m_isLaidOut = false;
+    size_t m_arenaSize = 0; // Of the tree, when last laid out
+    size_t m_editCount = 0; // Of the tree, when last laid out
+    size_t m_revision = 0;
+    size_t m_rebuildCount = 0;
+
+    void rebuild();
+    bool appendNode(NodeIndex);
 
     void processNodeRec(MoveTree::Iterator& iter_, int level_, int& row_, bool isNewLineSubvariation_ = false);
     void processNode(MoveTree::Iterator& iter_, int level_, int& row_, bool isNewLineSubvariation_ = false);
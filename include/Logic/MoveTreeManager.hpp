@@ -7,16 +7,14 @@
 #include "../Utilities/PieceTransition.hpp"
 
 #include <list>
+#include <map>
 #include <functional>
 #include <iterator>
-#include <SFML/Graphics.hpp>
 #include <stack>
 #include <string>
 #include <vector>
 #include <sstream>
 
-using namespace sf;
-
 struct UndoRedoMoveInfo;
 
 class MoveTreeManager
@@ -34,13 +32,16 @@ public:
     MoveTree::Iterator getNewIterator() { return m_moves.begin(); }
     MoveTree::Iterator& getIterator() { return m_moveIterator; }
     const MoveTree& getMoves() const { return m_moves; }
+    MoveTree& getMoves() { return m_moves; }
     Board& getBoard() { return m_board; }
     MoveTreeDisplayHandler& getMoveTreeDisplayHandler() { return m_moveTreeDisplayHandler; }
     PieceTransition& getTransitioningPiece() { return m_transitioningPiece; }
     int getIteratorIndex() { return 0; }
     int getMoveListSize() const { return m_moves.getNumberOfMoves(); }
+    // Hashes of the positions before the current one, from the root of the tree
+    const std::vector<uint64_t>& getPositionHistory() const { return m_positionHistory; }
 
-    void reset() { m_moves.clear(); m_moveIterator = m_moves.begin(); };
+    void reset() { m_moves.clear(); m_moveIterator = m_moves.begin(); m_positionHistory.clear(); };
     bool goToPreviousMove(bool, vector<Arrow>&);
     bool goToNextMove(bool, const std::optional<size_t>&, vector<Arrow>&);
     void goToCurrentMove(vector<Arrow>& arrowList) { while (goToNextMove(false, std::nullopt, arrowList)); }
@@ -54,6 +55,7 @@ private:
     MoveTree m_moves;
     MoveTreeDisplayHandler m_moveTreeDisplayHandler{m_moves};
     MoveTree::Iterator m_moveIterator = m_moves.begin();
+    std::vector<uint64_t> m_positionHistory;
     Board& m_board;
     PieceTransition m_transitioningPiece;
 
@@ -62,6 +64,7 @@ private:
     void applyMove(const shared_ptr<Move>&, bool, bool, vector<Arrow>&);
     void applyMove(bool, vector<Arrow>&);
     void undoMove(bool, vector<Arrow>&);
+    void restoreLastMovedPiece();
 
     void handleUndoMoveNormal(UndoRedoMoveInfo& undoRedoMoveInfo_);
     void handleUndoMoveCapture(UndoRedoMoveInfo& undoRedoMoveInfo_);
@@ -1,18 +1,41 @@
 #pragma once
-#include <memory>
+#include <cstdint>
+#include <optional>
+#include <string>
 #include "Move.hpp"
 
-class MoveTreeNode
+// Index of a node in the arena of its MoveTree
+typedef uint32_t NodeIndex;
+inline constexpr NodeIndex g_NO_NODE = UINT32_MAX;
+
+// Index of a string in the pool of its MoveTree
+inline constexpr uint32_t g_NO_STRING = UINT32_MAX;
+
+// Engine evaluation of the position reached by a move, from white's point of view
+struct MoveEvaluation
 {
-public:
-    explicit MoveTreeNode(const std::shared_ptr<Move>&); // Public for now for debbuging
-    MoveTreeNode() = default;
+    int m_centipawns = 0;
+    std::optional<int> m_mate; // Moves to mate, negative when black mates
+    int m_depth = 0;
+    std::string m_bestMove; // Engine's best reply, in long algebraic notation
+};
 
-    int childNumber = 0;
-    std::shared_ptr<MoveTreeNode> m_parent; // To go to previous move
-    std::shared_ptr<Move> m_move; // Key (public for now for debugging)
-    std::vector<std::shared_ptr<MoveTreeNode>> m_children; // To to go to next move
+// Annotations of a move, e.g. from EnginePool::annotate
+struct MoveAnnotation
+{
+    std::optional<MoveEvaluation> m_evaluation;
+    std::string m_comment;
+};
 
-private:
-    static inline int numberOfMoves = 0;
+// Links of a node to its neighbours. The children of a node are its first
+// child and the chain of that child's next siblings, main line first.
+struct MoveTreeNode
+{
+    NodeIndex m_parent = g_NO_NODE; // To go to previous move
+    NodeIndex m_firstChild = g_NO_NODE; // To go to next move
+    NodeIndex m_nextSibling = g_NO_NODE;
+    uint32_t m_depth = 0; // Plies from the root
+    uint32_t m_san = g_NO_STRING; // Notation of the move, in the string pool
+    uint16_t m_childCount = 0;
+    uint16_t m_siblingIndex = 0; // 0 for the main line
 };
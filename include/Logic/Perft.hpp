@@ -0,0 +1,41 @@
+#pragma once
+#include "Position.hpp"
+#include "CompactMove.hpp"
+#include "TranspositionTable.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Counts the leaf nodes of the legal move tree, the standard correctness
+// check and benchmark for move generation. Positions are copied and played
+// forward with Position::makeMove, the board and its pieces are not involved.
+namespace perft
+{
+    typedef std::vector<std::pair<CompactMove, uint64_t>> Divide; // Node count per root move
+    typedef TranspositionTable<uint64_t> NodeCountTable; // Subtree counts by position and depth
+
+    uint64_t countNodes(const Position&, int depth_);
+    Divide divide(const Position&, int depth_);
+
+    // Skips the subtrees whose count is already in the table, and records
+    // the others. Transpositions make this pay off from depth 4 or so.
+    uint64_t countNodes(const Position&, int depth_, NodeCountTable&);
+
+    // Same counts, with the tree split into subtrees that are spread over a
+    // work-stealing pool. Every subtree is played on its own position copy,
+    // while the table, if any, is shared by all threads.
+    uint64_t countNodesParallel(const Position&, int depth_, unsigned threadCount_, NodeCountTable* = nullptr);
+    Divide divideParallel(const Position&, int depth_, unsigned threadCount_, NodeCountTable* = nullptr);
+
+    // Published positions with their node counts, index i holding depth i + 1
+    struct ReferencePosition
+    {
+        std::string m_name;
+        std::string m_fen;
+        std::vector<uint64_t> m_nodes;
+    };
+
+    const std::vector<ReferencePosition>& getReferencePositions();
+}
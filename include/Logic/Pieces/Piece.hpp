@@ -1,5 +1,6 @@
 #pragma once
 #include "../Move.hpp"
+#include "../Bitboard.hpp"
 
 #include <utility>
 #include <vector>
@@ -7,7 +8,6 @@
 #include <iostream>
 
 enum class Team { WHITE, BLACK };
-enum class PieceType { PAWN, ROOK, KNIGHT, BISHOP, KING, QUEEN };
 
 std::ostream& operator<<(std::ostream&, const PieceType&);
 std::ostream& operator<<(std::ostream&, Team);
@@ -38,18 +38,18 @@ public:
     PieceType getType() const { return m_type; }
     const std::string& getFileName() const { return m_filename; }
     MoveType getLastMove() const { return m_lastMove; }
-    static std::shared_ptr<Piece> getLastMovedPiece() { return m_lastPiece; }
     int getRank() const { return m_rank; }
     int getFile() const { return m_file; }
     bool isCached() const { return m_rank == -1 || m_file == -1; }
     bool hasMoved() const { return m_moved; }
     void setAsFirstMovement() { m_moved = false; }
+    void setAsMoved() { m_moved = true; }
     void addHorizontalAndVerticalMovements(Board&, std::vector<Move>&) const;
     void addDiagonalMovements(Board&, std::vector<Move>&) const;
+    void addMovementsToTargets(Board&, Bitboard, std::vector<Move>&) const;
 
     /* Setters */
     void setLastMove(MoveType newMove) { m_lastMove = newMove; }
-    static void setLastMovedPiece(const std::shared_ptr<Piece>& piece) { m_lastPiece = piece; }
 
     /* Utility functions */
     virtual std::vector<Move> calcPossibleMoves(Board&) const = 0; // Pure virtual function
@@ -63,7 +63,6 @@ public:
 private:
     /* Static members */
     inline const static std::string fileExt = ".png"; // Pieces file extension
-    inline static std::shared_ptr<Piece> m_lastPiece; // Last moved piece
 
     /* Class members */
     std::string m_filename; // Filename for this piece
@@ -0,0 +1,85 @@
+#pragma once
+#include "Bitboard.hpp"
+#include "Pieces/Piece.hpp"
+#include "CompactMove.hpp"
+#include "Zobrist.hpp"
+
+#include <cstdint>
+
+inline constexpr int g_NUMBER_OF_TEAMS = 2;
+inline constexpr int g_NUMBER_OF_PIECE_TYPES = 6;
+
+inline int teamIndex(Team team_) { return static_cast<int>(team_); }
+inline int pieceTypeIndex(PieceType type_) { return static_cast<int>(type_); }
+inline Team opponentOf(Team team_) { return (team_ == Team::WHITE)? Team::BLACK: Team::WHITE; }
+
+// Castling rights, combined as bit flags
+inline constexpr uint8_t g_NO_CASTLING = 0;
+inline constexpr uint8_t g_WHITE_KINGSIDE = 1 << 0;
+inline constexpr uint8_t g_WHITE_QUEENSIDE = 1 << 1;
+inline constexpr uint8_t g_BLACK_KINGSIDE = 1 << 2;
+inline constexpr uint8_t g_BLACK_QUEENSIDE = 1 << 3;
+
+inline uint8_t kingSideCastlingRight(Team team_) { return (team_ == Team::WHITE)? g_WHITE_KINGSIDE: g_BLACK_KINGSIDE; }
+inline uint8_t queenSideCastlingRight(Team team_) { return (team_ == Team::WHITE)? g_WHITE_QUEENSIDE: g_BLACK_QUEENSIDE; }
+
+// Bitboard-backed description of a chess position. It holds one bitboard
+// per piece type and team, the occupancy of each team, and a square-indexed
+// mailbox so that the piece on a given square can be read in O(1), along with
+// the side to move, the castling rights and the en passant square.
+// Its Zobrist hash is kept up to date by every mutator below.
+// This is a plain value type: it can be copied freely and owns no pieces.
+class Position
+{
+public:
+    Position() { clear(); }
+
+    void clear();
+    void setPiece(int square_, Team, PieceType);
+    void removePiece(int square_);
+    void makeMove(CompactMove); // Plays a legal move of the side to move
+
+    // Getters and setters
+    Bitboard getPieces(Team team_, PieceType type_) const { return m_pieces[teamIndex(team_)][pieceTypeIndex(type_)]; }
+    Bitboard getOccupancy(Team team_) const { return m_occupancy[teamIndex(team_)]; }
+    Bitboard getOccupancy() const { return m_occupancy[0] | m_occupancy[1]; }
+    bool isEmpty(int square_) const { return m_mailbox[square_] == g_EMPTY_SQUARE; }
+    Team getTeamAt(int square_) const;
+    PieceType getTypeAt(int square_) const;
+    int getKingSquare(Team) const;
+
+    // Whether any piece of byTeam_ attacks square_. The overload taking an
+    // occupancy lets callers look through pieces, e.g. the king that is moving.
+    bool isSquareAttacked(int square_, Team byTeam_) const { return isSquareAttacked(square_, byTeam_, getOccupancy()); }
+    bool isSquareAttacked(int square_, Team byTeam_, Bitboard occupancy_) const;
+
+    Team getTurn() const { return m_turn; }
+    void setTurn(Team turn_) { if (turn_ != m_turn) switchTurn(); }
+    void switchTurn();
+    uint8_t getCastlingRights() const { return m_castlingRights; }
+    void setCastlingRights(uint8_t);
+    bool hasCastlingRight(uint8_t castlingRight_) const { return m_castlingRights & castlingRight_; }
+    int getEnPassantSquare() const { return m_enPassantSquare; } // Square a pawn may capture onto en passant
+    void setEnPassantSquare(int square_);
+
+    // Whether a pawn of byTeam_ stands ready to capture en passant on square_.
+    // The square is only recorded when it does, so that the same position
+    // reached with or without a double push gets the same hash.
+    bool canCaptureEnPassant(int square_, Team byTeam_) const;
+
+    uint64_t getHash() const { return m_hash; }
+    uint64_t computeHash() const; // From scratch, to validate the incremental hash
+
+    void print(std::ostream& os_ = std::cout) const;
+
+private:
+    inline static constexpr int8_t g_EMPTY_SQUARE = -1;
+
+    Bitboard m_pieces[g_NUMBER_OF_TEAMS][g_NUMBER_OF_PIECE_TYPES];
+    Bitboard m_occupancy[g_NUMBER_OF_TEAMS];
+    int8_t m_mailbox[bitboard::g_NUMBER_OF_SQUARES]; // team * 6 + piece type, or g_EMPTY_SQUARE
+    Team m_turn = Team::WHITE;
+    uint8_t m_castlingRights = g_NO_CASTLING;
+    int m_enPassantSquare = bitboard::g_NO_SQUARE;
+    uint64_t m_hash = 0;
+};
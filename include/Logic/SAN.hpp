@@ -0,0 +1,24 @@
+#pragma once
+#include "Position.hpp"
+#include "CompactMove.hpp"
+
+#include <string>
+#include <string_view>
+
+// Standard algebraic notation, as found in PGN movetext ("Nbd7", "exd8=Q+",
+// "O-O-O"). Moves are resolved against the legal moves of the position, so
+// that a token which is illegal, or which fits several moves, is rejected
+// instead of being guessed.
+namespace san
+{
+    // The legal move of the side to move written as move_, or a null move
+    // (see CompactMove::isNull) if there is no such move or more than one.
+    // Check marks and annotations ("+", "#", "!", "?") are ignored, and
+    // castling may be written with zeros.
+    CompactMove parseMove(const Position&, std::string_view move_);
+
+    // move_, a legal move of the side to move, as written in PGN: with the
+    // origin file, rank or square only when another piece of the same type
+    // could reach the same square, and with "+" or "#" when it checks
+    std::string toSAN(const Position&, CompactMove move_);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// Bounded cache of values computed for a position, keyed by its Zobrist hash
+// (see Zobrist.hpp). Each key maps to a single slot and a new value always
+// replaces the old one, so memory use is fixed on construction.
+//
+// The table is lock-free and may be shared between threads. Every slot is
+// guarded by a sequence number, odd while a write is in progress and zero
+// until the first one. A reader that sees the slot change under it reports
+// a miss, and a writer finding the slot busy drops its value instead of
+// waiting.
+// Values are copied word by word through relaxed atomics, which is why they
+// must be trivially copyable.
+template <typename Value>
+class TranspositionTable
+{
+    static_assert(std::is_trivially_copyable_v<Value>, "Values are copied as raw words");
+
+public:
+    // The entry count is rounded down to a power of two
+    explicit TranspositionTable(size_t entryCount_):
+        m_size(roundDownToPowerOfTwo(entryCount_)),
+        m_pSlots(std::make_unique<Slot[]>(m_size))
+    {
+    }
+
+    bool probe(uint64_t key_, Value& value_) const
+    {
+        const Slot& slot = getSlot(key_);
+        const uint64_t sequence = slot.m_sequence.load(std::memory_order_acquire);
+        if (sequence == 0 || (sequence & 1) || slot.m_key.load(std::memory_order_relaxed) != key_) return false;
+
+        uint64_t words[g_WORDS];
+        for (size_t i = 0; i < g_WORDS; ++i) words[i] = slot.m_words[i].load(std::memory_order_relaxed);
+
+        // Discard what was read if a writer went through in the meantime
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.m_sequence.load(std::memory_order_relaxed) != sequence) return false;
+
+        std::memcpy(&value_, words, sizeof(Value));
+        return true;
+    }
+
+    void store(uint64_t key_, const Value& value_)
+    {
+        Slot& slot = getSlot(key_);
+        uint64_t sequence = slot.m_sequence.load(std::memory_order_relaxed);
+        if ((sequence & 1) || !slot.m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed))
+            return;
+        std::atomic_thread_fence(std::memory_order_release);
+
+        uint64_t words[g_WORDS] = {};
+        std::memcpy(words, &value_, sizeof(Value));
+        slot.m_key.store(key_, std::memory_order_relaxed);
+        for (size_t i = 0; i < g_WORDS; ++i) slot.m_words[i].store(words[i], std::memory_order_relaxed);
+
+        slot.m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Forgets every value. Not to be called while other threads use the table.
+    void clear()
+    {
+        for (size_t i = 0; i < m_size; ++i)
+        {
+            m_pSlots[i].m_sequence.store(0, std::memory_order_relaxed);
+            m_pSlots[i].m_key.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t getSize() const { return m_size; }
+
+private:
+    inline static constexpr size_t g_WORDS = (sizeof(Value) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot
+    {
+        std::atomic<uint64_t> m_sequence{0};
+        std::atomic<uint64_t> m_key{0};
+        std::atomic<uint64_t> m_words[g_WORDS] = {};
+    };
+
+    size_t m_size;
+    std::unique_ptr<Slot[]> m_pSlots;
+
+    Slot& getSlot(uint64_t key_) { return m_pSlots[key_ & (m_size - 1)]; }
+    const Slot& getSlot(uint64_t key_) const { return m_pSlots[key_ & (m_size - 1)]; }
+
+    static size_t roundDownToPowerOfTwo(size_t count_)
+    {
+        assert(count_ > 0);
+        size_t size = 1;
+        while (size * 2 <= count_) size *= 2;
+        return size;
+    }
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include "Bitboard.hpp"
+
+#include <cstdint>
+
+// Random keys of Zobrist hashing. The hash of a position is the XOR of the
+// keys of everything in it: each piece on its square, the side to move when
+// it is black, the castling rights and the file of the en passant square.
+// Any change to the position is then reflected by XOR-ing the keys of what
+// was added or removed. The keys are generated at compile time from a fixed
+// seed, so hashes are reproducible from one run to the next.
+namespace zobrist
+{
+    inline constexpr int g_NUMBER_OF_CASTLING_RIGHTS = 16; // Every combination of the four rights
+
+    struct Keys
+    {
+        uint64_t m_pieces[2][6][bitboard::g_NUMBER_OF_SQUARES]; // [team index][piece type index][square]
+        uint64_t m_blackToMove;
+        uint64_t m_castlingRights[g_NUMBER_OF_CASTLING_RIGHTS];
+        uint64_t m_enPassantFiles[8];
+    };
+
+    extern const Keys g_keys;
+
+    inline uint64_t getPieceKey(int teamIndex_, int pieceTypeIndex_, int square_) { return g_keys.m_pieces[teamIndex_][pieceTypeIndex_][square_]; }
+    inline uint64_t getBlackToMoveKey() { return g_keys.m_blackToMove; }
+    inline uint64_t getCastlingRightsKey(uint8_t castlingRights_) { return g_keys.m_castlingRights[castlingRights_]; }
+
+    // No key for the absence of an en passant square
+    inline uint64_t getEnPassantKey(int square_)
+    {
+        return (square_ == bitboard::g_NO_SQUARE)? 0: g_keys.m_enPassantFiles[bitboard::getFile(square_)];
+    }
+}
@@ -5,6 +5,7 @@
 #include "../Logic/MoveTreeManager.hpp"
 #include "MoveBox.hpp"
 #include <SFML/Graphics.hpp>
+#include <optional>
 
 using namespace std;
 using namespace sf;
@@ -28,21 +29,34 @@ public:
     void goToNextRow(int height);
     void addMove(const MoveInfo&);
     void initializeMoveBoxCoodinates(const MoveInfo&, coor2d&);
-    void drawMoves(std::vector<MoveInfo>, const coor2d&);
+    void drawMoves(MoveTreeDisplayHandler&, const coor2d&);
     void drawSquareBracket(coor2d&, int, bool) const;
-    void drawMove(std::vector<MoveInfo>&, size_t, const coor2d&, bool);
     void checkOutOfBounds(MoveBox&, int);
     void handleMoveBoxClicked(const coor2d&) const;
     void handleMoveBoxOutOfBounds(coor2d&, MoveBox&, MoveInfo&);
-    void drawFromNode(const shared_ptr<MoveTreeNode>&, int, int, coor2d&, const coor2d&);
-    void drawMovePrefix(const std::string&, coor2d&);
 
 private:
+    // A move box, with the prefix of the variation it starts if any, in place
+    // to be drawn
+    struct PlacedMove
+    {
+        MoveBox m_moveBox;
+        NodeIndex m_node = g_NO_NODE;
+        std::optional<std::pair<Text, RectangleShape>> m_prefix;
+    };
+
+    void layoutMove(MoveInfo);
+    void placeMovePrefix(PlacedMove&, const std::string&, coor2d&);
+
     RenderWindow& m_window;
     MoveTreeManager& m_moveTreeManager;
     coor2d m_nextPos = {ui::g_BORDER_SIZE + 10, 10};
     int moveBoxCounter = 0;
     int m_row = 0;
     int m_previousRow = 0;
+    int m_rowShift = 0; // Rows added by wrapped lines so far
+    std::vector<PlacedMove> m_placedMoves;
+    size_t m_layoutRevision = 0; // Of the move infos laid out
+    size_t m_layoutRebuildCount = 0;
     bool& m_showMoveSelectionPanel;
 };
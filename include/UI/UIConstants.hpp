@@ -20,4 +20,7 @@ namespace ui
     inline constexpr int g_MAIN_PANEL_HEIGHT = g_PANEL_SIZE - g_SOUTH_PANEL_HEIGHT;
     inline constexpr float g_SPRITE_SIZE = 128;
     inline constexpr float g_BUTTON_SIZE = 40;
+
+    inline int getWindowXPos(int file_) { return file_ * g_CELL_SIZE; }
+    inline int getWindowYPos(int row_) { return row_ * g_CELL_SIZE + g_MENUBAR_HEIGHT; }
 }
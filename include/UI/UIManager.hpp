@@ -15,6 +15,7 @@
 #include "../Logic/Pieces/Queen.hpp"
 #include "../Logic/Pieces/Piece.hpp"
 #include "UIConstants.hpp"
+#include "../Engine/AnalysisWorker.hpp"
 
 #include <SFML/Graphics.hpp>
 
@@ -45,8 +46,6 @@ namespace ui {
         return sf::RectangleShape({g_CELL_SIZE, g_CELL_SIZE});
     }
 
-    inline int getWindowXPos(int file_) { return file_ * g_CELL_SIZE; }
-    inline int getWindowYPos(int row_) { return row_ * g_CELL_SIZE + g_MENUBAR_HEIGHT; }
     int getFile(const coor2d& pos_, bool isFlipped_ = false);
     int getRank(const coor2d& pos_, bool isFlipped_ = false);
     
@@ -73,6 +72,10 @@ namespace ui {
 
             void resetUserInputStatesAfterNewMove(ClickState&, DragState&);
 
+            // Background analysis is off until turned on
+            void toggleAnalysis();
+            bool isAnalysisEnabled() const { return m_isAnalysisEnabled; }
+
         private:
             sf::RenderWindow m_window = {
                 sf::VideoMode(g_WINDOW_SIZE + g_PANEL_SIZE, g_WINDOW_SIZE + g_MENUBAR_HEIGHT),
@@ -86,11 +89,17 @@ namespace ui {
 
             bool m_showMoveSelectionPanel = false;
 
+            // Engine analysis of the displayed position, searched in the background
+            engine::AnalysisWorker m_analysisWorker;
+            bool m_isAnalysisEnabled = false;
+            uint64_t m_analysedHash = 0;
+            engine::AnalysisUpdate m_analysis;
+
             void initializeMenuBar();
             void drawMenuBar();
             void drawSidePanel();
-            void drawCaptureCircles(const std::shared_ptr<Piece>&, const vector<Move>&);
-            void highlightHoveredSquare(const std::shared_ptr<Piece>&, const coor2d&, const vector<Move>&);
+            void drawCaptureCircles(const std::shared_ptr<Piece>&, const MoveList&);
+            void highlightHoveredSquare(const std::shared_ptr<Piece>&, const coor2d&, const MoveList&);
             void drawPieces();
             void drawDraggedPiece(const std::shared_ptr<Piece>&, const coor2d&);
             void drawTransitioningPiece(PieceTransition&);
@@ -101,5 +110,7 @@ namespace ui {
             void drawGrayCover();
             void drawBoardSquares();
             void highlightLastMove();
+            void updateAnalysis(const DragState&);
+            void drawAnalysis();
     }; 
 }
\ No newline at end of file
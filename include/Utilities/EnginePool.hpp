@@ -0,0 +1,87 @@
+#pragma once
+#include "UCIEngine.hpp"
+
+#include <map>
+#include <memory>
+
+class MoveTree;
+
+// Set of UCI engine processes searching a batch of positions. Positions wait
+// in a queue and are handed to whichever engine is idle; a single thread
+// drives every engine, sleeping in poll(2) until one of them writes.
+//
+// An engine that dies, or does not answer in time, is restarted and its
+// position goes back to the queue, up to g_MAX_ATTEMPTS times.
+class EnginePool
+{
+public:
+    inline static constexpr int g_MAX_ATTEMPTS = 3;
+
+    struct Job
+    {
+        std::string m_fen; // Empty for the starting position
+        std::vector<std::string> m_moves; // Played from there, in long algebraic notation
+    };
+
+    struct JobResult
+    {
+        bool m_isValid = false; // False if every attempt failed
+        UCIInfo m_info; // Last scored info line of the best variation
+        UCIEngine::BestMove m_bestMove;
+    };
+
+    struct Stats
+    {
+        size_t m_positions = 0; // Positions searched successfully
+        size_t m_restarts = 0; // Engines restarted after a failure
+        std::chrono::milliseconds m_time{0};
+
+        double getPositionsPerSecond() const
+        {
+            return (m_time.count() > 0)? m_positions * 1000.0 / m_time.count(): 0;
+        }
+    };
+
+    EnginePool(std::string command_, std::vector<std::string> arguments_, unsigned engineCount_);
+    ~EnginePool();
+
+    EnginePool(const EnginePool&) = delete;
+    EnginePool& operator=(const EnginePool&) = delete;
+
+    // Sent to every engine on start, including after a restart
+    void setOption(const std::string& name_, const std::string& value_) { m_options[name_] = value_; }
+
+    // A job taking longer than this counts as a failure. Zero waits forever.
+    void setJobTimeout(std::chrono::milliseconds timeout_) { m_jobTimeout = timeout_; }
+
+    // Results are in the order of the jobs
+    std::vector<JobResult> run(const std::vector<Job>&, const UCIGoLimits&);
+
+    // Evaluates the position after every move of the tree, variations
+    // included, and stores it in the node along with an "[%eval ...]"
+    // comment. initialFen_ is the position the tree starts from.
+    void annotate(MoveTree&, const UCIGoLimits&, const std::string& initialFen_ = "");
+
+    // Of the last run or annotate
+    const Stats& getStats() const { return m_stats; }
+    unsigned getEngineCount() const { return static_cast<unsigned>(m_slots.size()); }
+
+private:
+    struct Slot
+    {
+        std::unique_ptr<UCIEngine> m_pEngine;
+        int m_job = -1; // Index of the job being searched, -1 when idle
+        std::chrono::steady_clock::time_point m_jobStart;
+        UCIInfo m_lastInfo;
+    };
+
+    std::string m_command;
+    std::vector<std::string> m_arguments;
+    std::map<std::string, std::string> m_options;
+    std::chrono::milliseconds m_jobTimeout = std::chrono::minutes(1);
+
+    std::vector<Slot> m_slots;
+    Stats m_stats;
+
+    bool startEngine(Slot&);
+};
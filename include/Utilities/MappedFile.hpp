@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only memory mapping of a whole file. Pages are loaded by the kernel
+// as they are first read and can be dropped again under memory pressure,
+// so even a file larger than the memory can be read as one string_view.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& fileName_);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return m_isOpen; }
+    std::string_view getText() const { return std::string_view(static_cast<const char*>(m_pData), m_size); }
+
+private:
+    void* m_pData = nullptr;
+    size_t m_size = 0;
+    bool m_isOpen = false;
+};
@@ -0,0 +1,54 @@
+#pragma once
+#include "../Logic/Position.hpp"
+#include "PGNReader.hpp"
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Replays the games of PGN archives through the legal move generator,
+// variations included, and reports on each of them.
+//
+// Text in memory, typically a memory-mapped file, is cut into chunks at
+// game boundaries (lines starting with an Event tag) that are read and
+// checked on a work-stealing pool, each chunk with its own reader and
+// positions. Reports still come out in the order of the games, a batch of
+// chunks at a time, so memory stays bounded on archives of any size.
+class PGNChecker
+{
+public:
+    inline static constexpr size_t g_DEFAULT_CHUNK_SIZE = 1 << 20; // Bytes, rounded up to the next game
+
+    struct GameReport
+    {
+        size_t m_index = 0; // From 1, in file order
+        int m_plies = 0; // Main line and variations
+        std::string m_result;
+        std::vector<std::string> m_errors; // Syntax errors first, then illegal moves
+    };
+
+    typedef std::function<void(const GameReport&)> ReportCallback;
+
+    explicit PGNChecker(unsigned threadCount_ = 1, size_t chunkSize_ = g_DEFAULT_CHUNK_SIZE);
+
+    GameReport checkGame(const PGNGame&) const;
+
+    // The callback is always called from the calling thread
+    void checkText(std::string_view text_, const ReportCallback&) const;
+    void checkStream(std::istream&, const ReportCallback&) const;
+
+    unsigned getThreadCount() const { return m_threadCount; }
+
+    // Consecutive pieces of text_ of about chunkSize_ bytes, each starting
+    // at a game, except the first one which starts at the beginning
+    static std::vector<std::string_view> splitIntoChunks(std::string_view text_, size_t chunkSize_);
+
+private:
+    unsigned m_threadCount;
+    size_t m_chunkSize;
+    Position m_startPosition;
+
+    void checkGames(PGNReader&, const ReportCallback&) const;
+};
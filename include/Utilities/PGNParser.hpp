@@ -1,7 +1,9 @@
 #include "iostream"
 #include "vector"
+#include "PGNTokenizer.hpp"
 
 #include <stack>
+#include <string_view>
 
 class Move;
 class Board;
@@ -24,7 +26,8 @@ private:
 
     void split(const char* data);
 
-    std::vector<std::string> tokenizePGNString(const std::string& pgn);
-    void parseAllTokens(const std::vector<std::string>& tokens, size_t& index, int& moveCount, std::stack<int>& undoStack);
+    std::vector<PGNToken> tokenizePGNString(std::string_view pgn);
+    void parseAllTokens(const std::vector<PGNToken>& tokens, size_t& index, int& moveCount, std::stack<int>& undoStack);
     void addMoveToPGNTree(const std::string& token_);
+    void addCommentToPGNTree(std::string_view comment_);
 };
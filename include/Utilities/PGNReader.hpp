@@ -0,0 +1,66 @@
+#pragma once
+#include "PGNTokenizer.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Item of PGN movetext. Move numbers are not kept: they follow from the
+// position of the moves.
+struct PGNElement
+{
+    enum class Type { MOVE, COMMENT, NAG, VARIATION_START, VARIATION_END };
+
+    Type m_type;
+    std::string_view m_text; // SAN move, comment without its braces, or NAG number without '$'
+};
+
+// One game of a PGN file. Every view points into the reader that filled
+// the record and stays valid until its next readGame.
+struct PGNGame
+{
+    std::vector<std::pair<std::string_view, std::string_view>> m_tags; // Name and value, in file order
+    std::vector<PGNElement> m_movetext; // Variations are nested between VARIATION_START and VARIATION_END
+    std::string_view m_result; // Termination marker, "*" if there is none
+    std::vector<std::string> m_errors; // Syntax errors, the game is read anyway
+
+    std::string_view getTag(std::string_view name_) const;
+    void clear();
+};
+
+// Walks PGN text one game at a time, either from a stream or from text
+// already in memory, typically a memory-mapped file (see MappedFile).
+// Every game is split by a PGNTokenizer in a single pass. Text in memory is
+// not copied: the views of the record point straight into it. A stream is
+// read line by line and only the text of the current game is held. Either
+// way the record passed to readGame keeps its capacity from one game to the
+// next, so memory does not grow with the number of games.
+//
+// A game runs up to the first tag pair that follows its movetext, so that
+// games missing their termination marker (1-0, 0-1, 1/2-1/2 or *) are still
+// told apart.
+class PGNReader
+{
+public:
+    explicit PGNReader(std::istream&);
+    explicit PGNReader(std::string_view text_); // The text must outlive the reader
+
+    // False once there is no more game
+    bool readGame(PGNGame&);
+
+    size_t getGameCount() const { return m_gameCount; }
+
+private:
+    std::istream* m_pInput = nullptr; // Null when reading text in memory
+    PGNTokenizer m_tokenizer; // Over the text in memory, or the current game of the stream
+    std::string m_gameText; // Tags and movetext of the current game of the stream
+    std::string m_line;
+    bool m_hasPendingLine = false; // m_line holds the first tag pair of the next game
+    size_t m_gameCount = 0;
+
+    bool readGameText();
+    bool readLine();
+    bool parseGame(PGNGame&);
+};
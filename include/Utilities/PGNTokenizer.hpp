@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+struct PGNToken
+{
+    enum class Type { TAG_PAIR, MOVE, COMMENT, NAG, VARIATION_START, VARIATION_END, RESULT, ERROR };
+
+    Type m_type;
+    std::string_view m_text; // Tag name, SAN move, comment without its delimiters, NAG without '$', or error message
+    std::string_view m_value; // Tag value, escapes included
+};
+
+// Splits PGN text into tokens in one forward pass. Tokens are views into the
+// text, which is never copied nor modified, so the text must outlive them;
+// it is typically a whole memory-mapped file (see MappedFile).
+//
+// Move numbers ("12." or "12...") are skipped, even when glued to the move,
+// and so are escaped lines starting with '%'. Suffix annotations written
+// apart from their move ("!?") are returned as NAGs. Malformed input gives
+// an ERROR token and the tokenizer moves on.
+class PGNTokenizer
+{
+public:
+    explicit PGNTokenizer(std::string_view text_): m_text(text_) {}
+
+    // False at the end of the text
+    bool next(PGNToken&);
+
+    size_t getOffset() const { return m_offset; } // Of the next token
+    void setOffset(size_t offset_) { m_offset = offset_; }
+
+private:
+    std::string_view m_text;
+    size_t m_offset = 0;
+
+    bool isAtLineStart(size_t offset_) const { return offset_ == 0 || m_text[offset_ - 1] == '\n'; }
+    size_t findLineEnd(size_t offset_) const;
+    void readTagPair(PGNToken&);
+    void readComment(PGNToken&);
+    void readSymbol(PGNToken&);
+};
@@ -0,0 +1,60 @@
+#pragma once
+#include "../Logic/MoveTree.hpp"
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Writes move trees as PGN: the main line, each move followed by the
+// variations that replace it in parentheses, and the comments of the moves
+// in braces (engine evaluations included, see EnginePool::annotate). Moves
+// are written from the notation kept in the tree (see MoveTree::getSAN), in
+// one traversal appending straight into a buffer reserved up front.
+//
+// Written to a stream, the buffer is flushed whenever a game leaves it full,
+// so that any number of games go to one file with bounded memory. Lines are
+// wrapped before 80 characters, as the PGN export format asks.
+class PGNWriter
+{
+public:
+    inline static constexpr size_t g_DEFAULT_CAPACITY = 1 << 20; // Bytes
+    inline static constexpr size_t g_MAX_LINE_LENGTH = 79;
+
+    typedef std::vector<std::pair<std::string, std::string>> Tags; // Name and value
+
+    explicit PGNWriter(size_t capacity_ = g_DEFAULT_CAPACITY);
+    explicit PGNWriter(std::ostream&, size_t capacity_ = g_DEFAULT_CAPACITY);
+    ~PGNWriter();
+
+    PGNWriter(const PGNWriter&) = delete;
+    PGNWriter& operator=(const PGNWriter&) = delete;
+
+    // Tags come first, in the given order. A FEN tag sets the number of the
+    // first move and the side that plays it.
+    void writeGame(const MoveTree&, const Tags& tags_ = {}, std::string_view result_ = "*");
+
+    // Sends the text written so far to the stream, if any
+    void flush();
+
+    const std::string& getText() const { return m_buffer; } // Since the last flush
+    size_t getGameCount() const { return m_gameCount; }
+
+private:
+    std::ostream* m_pOutput = nullptr; // Null when writing to memory only
+    size_t m_capacity;
+    std::string m_buffer;
+    size_t m_lineStart = 0; // Offset of the current line in m_buffer
+    bool m_isAfterParenthesis = false; // The next token is glued to a '('
+    int m_firstPly = 0; // Of the game being written: 0 for white's first move
+    size_t m_gameCount = 0;
+
+    void writeTag(std::string_view name_, std::string_view value_);
+    void writeContinuation(const MoveTree&, NodeIndex parent_, bool isNumberNeeded_);
+    bool writeMove(const MoveTree&, NodeIndex, bool isNumberNeeded_);
+    void writeMoveNumber(int ply_, size_t moveLength_);
+    void writeComment(std::string_view);
+    void writeToken(std::string_view);
+    void startToken(size_t length_, bool isGlued_ = false);
+};
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Bounded lock-free queue between exactly one producer thread and one
+// consumer thread. Neither side ever waits: tryPush fails when the queue is
+// full and tryPop when it is empty.
+template <typename Item, size_t Capacity>
+class SPSCQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "The capacity must be a power of two");
+
+public:
+    // Producer thread only
+    bool tryPush(Item item_)
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail - m_head.load(std::memory_order_acquire) == Capacity) return false;
+
+        m_items[tail & (Capacity - 1)] = std::move(item_);
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only
+    bool tryPop(Item& item_)
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false;
+
+        item_ = std::move(m_items[head & (Capacity - 1)]);
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // Each index is written by one side only, keep them on separate cache lines
+    alignas(64) std::atomic<size_t> m_head{0}; // Next item to pop
+    alignas(64) std::atomic<size_t> m_tail{0}; // Next slot to push to
+    std::array<Item, Capacity> m_items;
+};
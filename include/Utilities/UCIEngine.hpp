@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+// One "info" line of a UCI engine. Fields the engine did not send keep
+// their default value.
+struct UCIInfo
+{
+    int m_depth = 0;
+    int m_selectiveDepth = 0;
+    int m_multiPV = 1; // 1 for the best line
+    std::optional<int> m_centipawns; // From the point of view of the side to move
+    std::optional<int> m_mate; // Moves to mate, negative when being mated
+    bool m_isLowerBound = false;
+    bool m_isUpperBound = false;
+    uint64_t m_nodes = 0;
+    uint64_t m_nodesPerSecond = 0;
+    std::chrono::milliseconds m_time{0};
+    int m_hashFull = 0; // Per mille
+    std::string m_currentMove;
+    std::vector<std::string> m_principalVariation; // Long algebraic notation, e.g. e7e8q
+    std::string m_string; // Free text of "info string"
+};
+
+UCIInfo parseUCIInfo(const std::string& line_);
+
+// How long a "go" may search. Without any limit the engine searches until stop().
+struct UCIGoLimits
+{
+    std::optional<int> m_depth;
+    std::optional<uint64_t> m_nodes;
+    std::optional<std::chrono::milliseconds> m_moveTime;
+    bool m_infinite = false;
+};
+
+// Client side of a UCI engine running as a child process. The engine is
+// started with fork and exec, its stdin and stdout being two pipes, and its
+// output is read without blocking: poll() only consumes what is already
+// there, while the wait functions sleep on the pipe until something comes
+// or the timeout expires. Every info line is parsed and handed to the
+// callback of the current search.
+//
+// Engines in a farm can be multiplexed by polling their output descriptors
+// (see getOutputFd) and calling poll() on the ready ones.
+class UCIEngine
+{
+public:
+    typedef std::function<void(const UCIInfo&)> InfoCallback;
+
+    struct BestMove
+    {
+        std::string m_move; // Empty if the engine had no legal move ("bestmove (none)")
+        std::string m_ponder;
+    };
+
+    // The engine is looked up in PATH like a shell would
+    explicit UCIEngine(std::string command_, std::vector<std::string> arguments_ = {});
+    ~UCIEngine();
+
+    UCIEngine(const UCIEngine&) = delete;
+    UCIEngine& operator=(const UCIEngine&) = delete;
+
+    // Starts the process and goes through the "uci" handshake. False if the
+    // engine could not be started or did not answer in time.
+    bool start(std::chrono::milliseconds timeout_ = std::chrono::seconds(10));
+
+    // Sends "quit", then kills the engine if it does not exit in time
+    void quit(std::chrono::milliseconds timeout_ = std::chrono::seconds(1));
+
+    bool isRunning() const { return m_pid > 0; }
+    const std::string& getName() const { return m_name; }
+    const std::vector<std::string>& getOptionNames() const { return m_optionNames; }
+
+    // e.g. setOption("Hash", "256"), setOption("Threads", "4"), setOption("MultiPV", "3")
+    void setOption(const std::string& name_, const std::string& value_);
+    bool isReady(std::chrono::milliseconds timeout_ = std::chrono::seconds(10));
+    void newGame();
+
+    // Moves are in long algebraic notation
+    void setPosition(const std::string& fen_, const std::vector<std::string>& moves_ = {});
+    void setStartPosition(const std::vector<std::string>& moves_ = {});
+
+    // Starts a search, the best move is then read with poll or waitForBestMove
+    void go(const UCIGoLimits&, InfoCallback = nullptr);
+    void stop();
+    bool isSearching() const { return m_isSearching; }
+
+    // Handles what the engine has written so far, without waiting. Returns
+    // the best move once the search is over.
+    std::optional<BestMove> poll();
+    std::optional<BestMove> waitForBestMove(std::chrono::milliseconds timeout_);
+
+    int getOutputFd() const { return m_outputFd; }
+
+private:
+    std::string m_command;
+    std::vector<std::string> m_arguments;
+
+    pid_t m_pid = -1;
+    int m_inputFd = -1; // Engine stdin, written by us
+    int m_outputFd = -1; // Engine stdout, read by us, non-blocking
+    std::string m_readBuffer; // Output not yet split into lines
+
+    std::string m_name;
+    std::vector<std::string> m_optionNames;
+    bool m_isUCIOk = false;
+    bool m_isReadyOk = false;
+    bool m_isSearching = false;
+    InfoCallback m_onInfo;
+    std::optional<BestMove> m_bestMove;
+
+    void send(const std::string& command_);
+    void readAvailable();
+    void handleLine(const std::string& line_);
+    bool waitFor(const std::function<bool()>& isDone_, std::chrono::milliseconds timeout_);
+    void closeProcess();
+};
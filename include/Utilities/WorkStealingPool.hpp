@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads, each with its own task queue. Submitted tasks
+// are spread over the queues; a worker takes from the back of its own queue
+// and, once it runs dry, steals from the front of the others, so that
+// unevenly sized tasks still keep every thread busy.
+class WorkStealingPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    explicit WorkStealingPool(unsigned threadCount_ = getDefaultThreadCount());
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Tasks submitted by a worker go to that worker's own queue
+    void submit(Task);
+
+    // Blocks until every submitted task has run
+    void wait();
+
+    unsigned getThreadCount() const { return static_cast<unsigned>(m_threads.size()); }
+
+    static unsigned getDefaultThreadCount();
+
+private:
+    struct TaskQueue
+    {
+        std::mutex m_mutex;
+        std::deque<Task> m_tasks;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> m_queues; // One per worker
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex; // Guards the wake up and completion conditions
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_allTasksDone;
+    std::atomic<size_t> m_queuedTasks{0}; // Submitted and not picked up yet
+    size_t m_pendingTasks = 0; // Submitted and not finished yet
+    bool m_stopping = false;
+    std::atomic<unsigned> m_nextQueue{0};
+
+    void workerLoop(unsigned);
+    bool popTask(unsigned, Task&);
+    bool stealTask(unsigned, Task&);
+};
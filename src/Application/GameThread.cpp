@@ -394,7 +394,8 @@ namespace game
             { Keyboard::LControl, [this] { handleKeyPressLControl(); } },
             { Keyboard::Up, [this, &uiManager_, &arrowList_] { handleKeyPressUp(uiManager_, arrowList_); } },
             { Keyboard::Down, [this, &uiManager_, &arrowList_] { handleKeyPressDown(uiManager_, arrowList_); } },
-            { Keyboard::Enter, [this, &uiManager_, &arrowList_] { handleKeyPressEnter(uiManager_, arrowList_); } }
+            { Keyboard::Enter, [this, &uiManager_, &arrowList_] { handleKeyPressEnter(uiManager_, arrowList_); } },
+            { Keyboard::A, [&uiManager_] { uiManager_.toggleAnalysis(); } }
         };
 
         executeKeyHandler(keyMap, event_.key.code);
@@ -402,7 +403,7 @@ namespace game
 
     shared_ptr<Move> GameThread::getCurrMoveTreeIteratorMove() 
     {
-        assert(m_treeIterator.get());
-        return m_treeIterator.get()->m_move;
+        assert(m_treeIterator.getIndex() != g_NO_NODE);
+        return m_treeIterator.getMove();
     }
 } // game namespace
@@ -0,0 +1,89 @@
+#include "../../include/Engine/AnalysisWorker.hpp"
+
+namespace engine
+{
+    AnalysisWorker::AnalysisWorker(unsigned threadCount_, size_t hashEntries_):
+        m_search(hashEntries_, threadCount_),
+        m_thread(&AnalysisWorker::run, this)
+    {
+    }
+
+    AnalysisWorker::~AnalysisWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_quit = true;
+        }
+        cancel();
+        m_requestAvailable.notify_one();
+        m_thread.join();
+    }
+
+    void AnalysisWorker::analyse(const Position& position_, const SearchLimits& limits_, std::vector<uint64_t> history_)
+    {
+        const uint64_t generation = ++m_generation;
+        m_search.stop();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_request = Request{position_, limits_, std::move(history_), generation};
+            m_hasRequest = true;
+        }
+        m_requestAvailable.notify_one();
+    }
+
+    void AnalysisWorker::cancel()
+    {
+        ++m_generation;
+        m_search.stop();
+    }
+
+    bool AnalysisWorker::pollUpdate(AnalysisUpdate& update_)
+    {
+        QueuedUpdate queued;
+        while (m_updates.tryPop(queued))
+        {
+            if (!isCurrent(queued.m_generation)) continue;
+            update_ = std::move(queued.m_update);
+            return true;
+        }
+        return false;
+    }
+
+    void AnalysisWorker::run()
+    {
+        while (true)
+        {
+            Request request;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_requestAvailable.wait(lock, [this]() { return m_quit || m_hasRequest; });
+                if (m_quit) return;
+                request = std::move(m_request);
+                m_hasRequest = false;
+            }
+            if (!isCurrent(request.m_generation)) continue;
+
+            const uint64_t positionHash = request.m_position.getHash();
+            auto publish = [this, &request, positionHash](const SearchResult& result_, bool isFinal_)
+            {
+                // Only fails if the consumer stopped polling, the update is then of no use anyway
+                m_updates.tryPush(QueuedUpdate{request.m_generation, AnalysisUpdate{positionHash, result_, isFinal_}});
+            };
+
+            const SearchResult result = m_search.run(request.m_position, request.m_limits, request.m_history,
+                [this, &request, &publish](const SearchResult& result_)
+                {
+                    // A stop requested just before this search began is reset by
+                    // Search::run, so a cancelled search also stops itself here
+                    if (!isCurrent(request.m_generation))
+                    {
+                        m_search.stop();
+                        return;
+                    }
+                    publish(result_, false);
+                });
+
+            if (isCurrent(request.m_generation)) publish(result, true);
+        }
+    }
+}
@@ -0,0 +1,137 @@
+#include "../../include/Engine/Evaluation.hpp"
+
+namespace
+{
+    typedef int SquareTable[bitboard::g_NUMBER_OF_SQUARES];
+
+    // Tables are laid out as seen by white, a8 first, so that they can be
+    // indexed by square directly for white and by the mirrored square for black
+    constexpr SquareTable g_PAWN_TABLE = {
+         0,  0,  0,  0,  0,  0,  0,  0,
+        50, 50, 50, 50, 50, 50, 50, 50,
+        10, 10, 20, 30, 30, 20, 10, 10,
+         5,  5, 10, 25, 25, 10,  5,  5,
+         0,  0,  0, 20, 20,  0,  0,  0,
+         5, -5,-10,  0,  0,-10, -5,  5,
+         5, 10, 10,-20,-20, 10, 10,  5,
+         0,  0,  0,  0,  0,  0,  0,  0
+    };
+
+    constexpr SquareTable g_ROOK_TABLE = {
+         0,  0,  0,  0,  0,  0,  0,  0,
+         5, 10, 10, 10, 10, 10, 10,  5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+        -5,  0,  0,  0,  0,  0,  0, -5,
+         0,  0,  0,  5,  5,  0,  0,  0
+    };
+
+    constexpr SquareTable g_KNIGHT_TABLE = {
+        -50,-40,-30,-30,-30,-30,-40,-50,
+        -40,-20,  0,  0,  0,  0,-20,-40,
+        -30,  0, 10, 15, 15, 10,  0,-30,
+        -30,  5, 15, 20, 20, 15,  5,-30,
+        -30,  0, 15, 20, 20, 15,  0,-30,
+        -30,  5, 10, 15, 15, 10,  5,-30,
+        -40,-20,  0,  5,  5,  0,-20,-40,
+        -50,-40,-30,-30,-30,-30,-40,-50
+    };
+
+    constexpr SquareTable g_BISHOP_TABLE = {
+        -20,-10,-10,-10,-10,-10,-10,-20,
+        -10,  0,  0,  0,  0,  0,  0,-10,
+        -10,  0,  5, 10, 10,  5,  0,-10,
+        -10,  5,  5, 10, 10,  5,  5,-10,
+        -10,  0, 10, 10, 10, 10,  0,-10,
+        -10, 10, 10, 10, 10, 10, 10,-10,
+        -10,  5,  0,  0,  0,  0,  5,-10,
+        -20,-10,-10,-10,-10,-10,-10,-20
+    };
+
+    constexpr SquareTable g_QUEEN_TABLE = {
+        -20,-10,-10, -5, -5,-10,-10,-20,
+        -10,  0,  0,  0,  0,  0,  0,-10,
+        -10,  0,  5,  5,  5,  5,  0,-10,
+         -5,  0,  5,  5,  5,  5,  0, -5,
+          0,  0,  5,  5,  5,  5,  0, -5,
+        -10,  5,  5,  5,  5,  5,  0,-10,
+        -10,  0,  5,  0,  0,  0,  0,-10,
+        -20,-10,-10, -5, -5,-10,-10,-20
+    };
+
+    constexpr SquareTable g_KING_MIDDLEGAME_TABLE = {
+        -30,-40,-40,-50,-50,-40,-40,-30,
+        -30,-40,-40,-50,-50,-40,-40,-30,
+        -30,-40,-40,-50,-50,-40,-40,-30,
+        -30,-40,-40,-50,-50,-40,-40,-30,
+        -20,-30,-30,-40,-40,-30,-30,-20,
+        -10,-20,-20,-20,-20,-20,-20,-10,
+         20, 20,  0,  0,  0,  0, 20, 20,
+         20, 30, 10,  0,  0, 10, 30, 20
+    };
+
+    constexpr SquareTable g_KING_ENDGAME_TABLE = {
+        -50,-40,-30,-20,-20,-30,-40,-50,
+        -30,-20,-10,  0,  0,-10,-20,-30,
+        -30,-10, 20, 30, 30, 20,-10,-30,
+        -30,-10, 30, 40, 40, 30,-10,-30,
+        -30,-10, 30, 40, 40, 30,-10,-30,
+        -30,-10, 20, 30, 30, 20,-10,-30,
+        -30,-30,  0,  0,  0,  0,-30,-30,
+        -50,-30,-30,-30,-30,-30,-30,-50
+    };
+
+    // In PieceType order, the king being handled apart
+    constexpr const SquareTable* g_SQUARE_TABLES[g_NUMBER_OF_PIECE_TYPES] = {
+        &g_PAWN_TABLE, &g_ROOK_TABLE, &g_KNIGHT_TABLE, &g_BISHOP_TABLE, nullptr, &g_QUEEN_TABLE
+    };
+
+    // Game phase weights: 24 with all pieces on the board, 0 with only kings and pawns
+    constexpr int g_PHASE_WEIGHTS[g_NUMBER_OF_PIECE_TYPES] = {0, 2, 1, 1, 0, 4};
+    constexpr int g_FULL_PHASE = 24;
+
+    int tableSquare(Team team_, int square_) { return (team_ == Team::WHITE)? square_: square_ ^ 56; }
+}
+
+namespace engine
+{
+    int evaluate(const Position& position_)
+    {
+        int scores[g_NUMBER_OF_TEAMS] = {0, 0};
+        int phase = 0;
+
+        for (Team team: {Team::WHITE, Team::BLACK})
+        {
+            for (int type = 0; type < g_NUMBER_OF_PIECE_TYPES; ++type)
+            {
+                const SquareTable* pTable = g_SQUARE_TABLES[type];
+                if (!pTable) continue;
+
+                Bitboard pieces = position_.getPieces(team, static_cast<PieceType>(type));
+                while (pieces)
+                {
+                    const int square = bitboard::popLsb(pieces);
+                    scores[teamIndex(team)] += g_PIECE_VALUES[type] + (*pTable)[tableSquare(team, square)];
+                    phase += g_PHASE_WEIGHTS[type];
+                }
+            }
+        }
+
+        // The king shelters early on and comes forward once the board empties
+        if (phase > g_FULL_PHASE) phase = g_FULL_PHASE;
+        for (Team team: {Team::WHITE, Team::BLACK})
+        {
+            const int kingSquare = position_.getKingSquare(team);
+            if (kingSquare == bitboard::g_NO_SQUARE) continue;
+
+            const int square = tableSquare(team, kingSquare);
+            scores[teamIndex(team)] += (g_KING_MIDDLEGAME_TABLE[square] * phase +
+                                        g_KING_ENDGAME_TABLE[square] * (g_FULL_PHASE - phase)) / g_FULL_PHASE;
+        }
+
+        const int whiteScore = scores[teamIndex(Team::WHITE)] - scores[teamIndex(Team::BLACK)];
+        return (position_.getTurn() == Team::WHITE)? whiteScore: -whiteScore;
+    }
+}
@@ -0,0 +1,447 @@
+#include "../../include/Engine/Search.hpp"
+#include "../../include/Engine/Evaluation.hpp"
+#include "../../include/Logic/MoveGenerator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // Kind of score stored in the transposition table
+    constexpr uint8_t g_EXACT_BOUND = 0;
+    constexpr uint8_t g_LOWER_BOUND = 1; // The search failed high, the score is at least this
+    constexpr uint8_t g_UPPER_BOUND = 2; // The search failed low, the score is at most this
+
+    // The clock and the node counts of the other threads are read once every so many nodes
+    constexpr uint64_t g_NODES_BETWEEN_LIMIT_CHECKS = 1024;
+
+    // Move ordering scores, highest tried first
+    constexpr int g_HASH_MOVE_SCORE = 1 << 30;
+    constexpr int g_CAPTURE_SCORE = 1 << 28;
+    constexpr int g_PROMOTION_SCORE = 1 << 27;
+    constexpr int g_FIRST_KILLER_SCORE = 1 << 26;
+    constexpr int g_SECOND_KILLER_SCORE = g_FIRST_KILLER_SCORE - 1;
+    constexpr int g_MAX_HISTORY_SCORE = g_SECOND_KILLER_SCORE - 1;
+
+    bool isCapture(const Position& position_, CompactMove move_)
+    {
+        return !position_.isEmpty(move_.getTo()) || move_.getMoveType() == MoveType::ENPASSANT;
+    }
+
+    bool isQuiet(const Position& position_, CompactMove move_)
+    {
+        return !isCapture(position_, move_) && move_.getMoveType() != MoveType::NEWPIECE;
+    }
+
+    // Mate scores are stored relative to the node, and read back relative to the root
+    int toTableScore(int score_, int ply_)
+    {
+        if (score_ >= engine::g_MATE_SCORE - engine::g_MAX_PLY) return score_ + ply_;
+        if (score_ <= -engine::g_MATE_SCORE + engine::g_MAX_PLY) return score_ - ply_;
+        return score_;
+    }
+
+    int fromTableScore(int score_, int ply_)
+    {
+        if (score_ >= engine::g_MATE_SCORE - engine::g_MAX_PLY) return score_ - ply_;
+        if (score_ <= -engine::g_MATE_SCORE + engine::g_MAX_PLY) return score_ + ply_;
+        return score_;
+    }
+}
+
+namespace engine
+{
+    // State of one search thread: node count, limits, ordering heuristics and
+    // the principal variation being built
+    class Search::Worker
+    {
+    public:
+        Worker(Search& search_, unsigned index_):
+            m_search(search_), m_table(search_.m_table), m_stopRequested(search_.m_stopRequested), m_index(index_)
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            std::memset(m_killers, 0, sizeof(m_killers));
+            std::memset(m_history, 0, sizeof(m_history));
+        }
+
+        SearchResult run(const Position&, const SearchLimits&, const std::vector<uint64_t>&, const IterationCallback&);
+
+        // Read by the main thread while this one searches
+        uint64_t getNodes() const { return m_nodes.load(std::memory_order_relaxed); }
+        void resetNodes() { m_nodes.store(0, std::memory_order_relaxed); }
+
+    private:
+        const Search& m_search;
+        SearchTable& m_table;
+        const std::atomic<bool>& m_stopRequested;
+        const unsigned m_index; // 0 for the main thread
+
+        SearchLimits m_limits;
+        Clock::time_point m_start;
+        std::atomic<uint64_t> m_nodes{0}; // Only ever written by this thread
+        int m_rootDepth = 0;
+        bool m_aborted = false;
+
+        std::vector<uint64_t> m_hashes; // Game history, then the positions of the current line
+        CompactMove m_killers[g_MAX_PLY][2]; // Quiet moves that caused a cutoff, per ply
+        int m_history[g_NUMBER_OF_TEAMS][bitboard::g_NUMBER_OF_SQUARES][bitboard::g_NUMBER_OF_SQUARES];
+        CompactMove m_principalVariations[g_MAX_PLY][g_MAX_PLY]; // Best line found from each ply
+        int m_principalVariationLengths[g_MAX_PLY];
+
+        int negamax(const Position&, int depth_, int alpha_, int beta_, int ply_);
+        int quiescence(const Position&, int alpha_, int beta_, int ply_);
+
+        void scoreMoves(const Position&, const MoveList&, CompactMove hashMove_, int ply_, int* scores_) const;
+        void recordCutoff(const Position&, CompactMove, int depth_, int ply_);
+        void updatePrincipalVariation(CompactMove, int ply_);
+        bool isRepetition(uint64_t hash_) const;
+        bool shouldStop();
+        std::chrono::milliseconds getElapsedTime() const;
+
+        bool isMain() const { return m_index == 0; }
+        void countNode() { m_nodes.store(getNodes() + 1, std::memory_order_relaxed); }
+    };
+
+    SearchResult Search::Worker::run(
+        const Position& position_,
+        const SearchLimits& limits_,
+        const std::vector<uint64_t>& history_,
+        const IterationCallback& onIteration_)
+    {
+        m_limits = limits_;
+        m_start = Clock::now();
+        m_aborted = false;
+        m_hashes = history_;
+
+        // Every other helper skips the first iteration, so that the threads
+        // are not all searching the same depth at the same time
+        const int firstDepth = 1 + static_cast<int>(m_index % 2);
+
+        SearchResult result;
+        const int maxDepth = std::clamp(limits_.m_depth, 1, g_MAX_PLY - 1);
+        for (m_rootDepth = firstDepth; m_rootDepth <= maxDepth; ++m_rootDepth)
+        {
+            const int score = negamax(position_, m_rootDepth, -g_INFINITE_SCORE, g_INFINITE_SCORE, 0);
+            if (m_aborted) break;
+
+            result.m_score = score;
+            result.m_depth = m_rootDepth;
+            result.m_nodes = m_search.countNodes();
+            result.m_time = getElapsedTime();
+            result.m_principalVariation.assign(m_principalVariations[0], m_principalVariations[0] + m_principalVariationLengths[0]);
+            result.m_bestMove = result.m_principalVariation.empty()? CompactMove(): result.m_principalVariation.front();
+            if (onIteration_) onIteration_(result);
+
+            // No legal move, or a forced mate found: deeper iterations would not change anything
+            if (result.m_bestMove.isNull() || (isMateScore(score) && g_MATE_SCORE - std::abs(score) <= m_rootDepth))
+                break;
+        }
+
+        result.m_time = getElapsedTime();
+        return result;
+    }
+
+    int Search::Worker::negamax(const Position& position_, int depth_, int alpha_, int beta_, int ply_)
+    {
+        m_principalVariationLengths[ply_] = 0;
+        if (shouldStop()) return 0;
+
+        const uint64_t hash = position_.getHash();
+        if (ply_ > 0 && isRepetition(hash)) return 0;
+        if (depth_ <= 0) return quiescence(position_, alpha_, beta_, ply_);
+        countNode();
+        if (ply_ >= g_MAX_PLY - 1) return evaluate(position_);
+
+        // A deep enough earlier result settles the node, except at the root where a move is needed
+        TranspositionEntry entry;
+        CompactMove hashMove;
+        if (m_table.probe(hash, entry))
+        {
+            hashMove = entry.m_move;
+            const int score = fromTableScore(entry.m_score, ply_);
+            if (ply_ > 0 && entry.m_depth >= depth_ &&
+                (entry.m_bound == g_EXACT_BOUND ||
+                 (entry.m_bound == g_LOWER_BOUND && score >= beta_) ||
+                 (entry.m_bound == g_UPPER_BOUND && score <= alpha_)))
+            {
+                return score;
+            }
+        }
+
+        const MoveGenerator generator(position_);
+        MoveList moves;
+        generator.generateLegalMoves(moves);
+        if (moves.empty()) return generator.isInCheck()? -g_MATE_SCORE + ply_: 0;
+
+        // Checks are searched one ply deeper so that forced sequences are seen through
+        if (generator.isInCheck()) ++depth_;
+
+        int scores[g_MAX_LEGAL_MOVES];
+        scoreMoves(position_, moves, hashMove, ply_, scores);
+
+        const int originalAlpha = alpha_;
+        int bestScore = -g_INFINITE_SCORE;
+        CompactMove bestMove;
+        CompactMove orderedMoves[g_MAX_LEGAL_MOVES];
+        std::copy(moves.begin(), moves.end(), orderedMoves);
+
+        m_hashes.push_back(hash);
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            // Selection sort, a cutoff usually comes before the list is sorted
+            const size_t best = std::max_element(scores + i, scores + moves.size()) - scores;
+            std::swap(scores[i], scores[best]);
+            std::swap(orderedMoves[i], orderedMoves[best]);
+            const CompactMove move = orderedMoves[i];
+
+            Position child = position_;
+            child.makeMove(move);
+
+            // The first move gets the full window, the others are first
+            // searched with a null window to prove they are no better
+            int score;
+            if (i == 0)
+            {
+                score = -negamax(child, depth_ - 1, -beta_, -alpha_, ply_ + 1);
+            }
+            else
+            {
+                score = -negamax(child, depth_ - 1, -alpha_ - 1, -alpha_, ply_ + 1);
+                if (score > alpha_ && score < beta_) score = -negamax(child, depth_ - 1, -beta_, -alpha_, ply_ + 1);
+            }
+            if (m_aborted) break;
+
+            if (score <= bestScore) continue;
+            bestScore = score;
+            bestMove = move;
+
+            if (score <= alpha_) continue;
+            alpha_ = score;
+            updatePrincipalVariation(move, ply_);
+
+            if (alpha_ >= beta_)
+            {
+                if (isQuiet(position_, move)) recordCutoff(position_, move, depth_, ply_);
+                break;
+            }
+        }
+        m_hashes.pop_back();
+        if (m_aborted) return 0;
+
+        const uint8_t bound = (bestScore >= beta_)? g_LOWER_BOUND: (bestScore > originalAlpha)? g_EXACT_BOUND: g_UPPER_BOUND;
+        m_table.store(hash, TranspositionEntry{
+            bestMove, static_cast<int16_t>(toTableScore(bestScore, ply_)), static_cast<int8_t>(depth_), bound});
+        return bestScore;
+    }
+
+    int Search::Worker::quiescence(const Position& position_, int alpha_, int beta_, int ply_)
+    {
+        if (shouldStop()) return 0;
+        countNode();
+        if (ply_ >= g_MAX_PLY - 1) return evaluate(position_);
+
+        const MoveGenerator generator(position_);
+        const bool inCheck = generator.isInCheck();
+
+        // Standing pat: the side to move may decline every capture. In check
+        // every evasion has to be searched instead.
+        int bestScore = -g_INFINITE_SCORE;
+        if (!inCheck)
+        {
+            bestScore = evaluate(position_);
+            if (bestScore >= beta_) return bestScore;
+            alpha_ = std::max(alpha_, bestScore);
+        }
+
+        MoveList moves;
+        generator.generateLegalMoves(moves);
+        if (moves.empty()) return inCheck? -g_MATE_SCORE + ply_: 0;
+
+        int scores[g_MAX_LEGAL_MOVES];
+        scoreMoves(position_, moves, CompactMove(), ply_, scores);
+        CompactMove orderedMoves[g_MAX_LEGAL_MOVES];
+        std::copy(moves.begin(), moves.end(), orderedMoves);
+
+        for (size_t i = 0; i < moves.size(); ++i)
+        {
+            const size_t best = std::max_element(scores + i, scores + moves.size()) - scores;
+            std::swap(scores[i], scores[best]);
+            std::swap(orderedMoves[i], orderedMoves[best]);
+            const CompactMove move = orderedMoves[i];
+            if (!inCheck && isQuiet(position_, move)) continue;
+
+            Position child = position_;
+            child.makeMove(move);
+            const int score = -quiescence(child, -beta_, -alpha_, ply_ + 1);
+            if (m_aborted) return 0;
+
+            if (score <= bestScore) continue;
+            bestScore = score;
+            if (score >= beta_) break;
+            alpha_ = std::max(alpha_, score);
+        }
+        return bestScore;
+    }
+
+    void Search::Worker::scoreMoves(
+        const Position& position_,
+        const MoveList& moves_,
+        CompactMove hashMove_,
+        int ply_,
+        int* scores_) const
+    {
+        const int team = teamIndex(position_.getTurn());
+        for (size_t i = 0; i < moves_.size(); ++i)
+        {
+            const CompactMove move = moves_[i];
+            if (move == hashMove_)
+            {
+                scores_[i] = g_HASH_MOVE_SCORE;
+            }
+            else if (isCapture(position_, move))
+            {
+                // Most valuable victim first, least valuable attacker to break ties
+                const PieceType victim = position_.isEmpty(move.getTo())? PieceType::PAWN: position_.getTypeAt(move.getTo());
+                scores_[i] = g_CAPTURE_SCORE + getPieceValue(victim) * 16 - getPieceValue(position_.getTypeAt(move.getFrom())) / 16;
+            }
+            else if (move.getMoveType() == MoveType::NEWPIECE)
+            {
+                scores_[i] = g_PROMOTION_SCORE + getPieceValue(move.getPromotion());
+            }
+            else if (move == m_killers[ply_][0])
+            {
+                scores_[i] = g_FIRST_KILLER_SCORE;
+            }
+            else if (move == m_killers[ply_][1])
+            {
+                scores_[i] = g_SECOND_KILLER_SCORE;
+            }
+            else
+            {
+                scores_[i] = m_history[team][move.getFrom()][move.getTo()];
+            }
+        }
+    }
+
+    void Search::Worker::recordCutoff(const Position& position_, CompactMove move_, int depth_, int ply_)
+    {
+        if (m_killers[ply_][0] != move_)
+        {
+            m_killers[ply_][1] = m_killers[ply_][0];
+            m_killers[ply_][0] = move_;
+        }
+
+        int& history = m_history[teamIndex(position_.getTurn())][move_.getFrom()][move_.getTo()];
+        history += depth_ * depth_;
+
+        // Halve every entry once one gets too large, so that they stay below the killers
+        if (history < g_MAX_HISTORY_SCORE / 2) return;
+        for (auto& teamHistory: m_history)
+            for (auto& fromHistory: teamHistory)
+                for (auto& entry: fromHistory) entry /= 2;
+    }
+
+    void Search::Worker::updatePrincipalVariation(CompactMove move_, int ply_)
+    {
+        m_principalVariations[ply_][0] = move_;
+        const int childLength = m_principalVariationLengths[ply_ + 1];
+        std::copy(m_principalVariations[ply_ + 1], m_principalVariations[ply_ + 1] + childLength, m_principalVariations[ply_] + 1);
+        m_principalVariationLengths[ply_] = childLength + 1;
+    }
+
+    bool Search::Worker::isRepetition(uint64_t hash_) const
+    {
+        // The last hash is the parent. The side to move is part of the hash, so
+        // only every other position before it can match.
+        for (int i = static_cast<int>(m_hashes.size()) - 2; i >= 0; i -= 2)
+        {
+            if (m_hashes[i] == hash_) return true;
+        }
+        return false;
+    }
+
+    bool Search::Worker::shouldStop()
+    {
+        if (m_aborted) return true;
+
+        // The main thread always completes the first iteration, so that there is a move to play
+        if (isMain() && m_rootDepth <= 1) return false;
+
+        const uint64_t nodes = getNodes();
+        const bool isCheckDue = nodes % g_NODES_BETWEEN_LIMIT_CHECKS == 0;
+        if (m_stopRequested.load(std::memory_order_relaxed) ||
+            (m_limits.m_nodes && (nodes >= m_limits.m_nodes || (isCheckDue && m_search.countNodes() >= m_limits.m_nodes))) ||
+            (m_limits.m_time.count() && isCheckDue && getElapsedTime() >= m_limits.m_time))
+        {
+            m_aborted = true;
+        }
+        return m_aborted;
+    }
+
+    std::chrono::milliseconds Search::Worker::getElapsedTime() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - m_start);
+    }
+
+    Search::Search(size_t hashEntries_, unsigned threadCount_):
+        m_table(hashEntries_)
+    {
+        setThreadCount(threadCount_);
+    }
+
+    Search::~Search() = default;
+
+    void Search::setThreadCount(unsigned threadCount_)
+    {
+        assert(threadCount_ > 0);
+        m_workers.resize(std::min<size_t>(m_workers.size(), threadCount_));
+        while (m_workers.size() < threadCount_)
+            m_workers.push_back(std::make_unique<Worker>(*this, static_cast<unsigned>(m_workers.size())));
+    }
+
+    SearchResult Search::run(
+        const Position& position_,
+        const SearchLimits& limits_,
+        const std::vector<uint64_t>& history_,
+        const IterationCallback& onIteration_)
+    {
+        m_stopRequested = false;
+        for (auto& pWorker: m_workers) pWorker->resetNodes();
+
+        // Helpers have no limits of their own, they search until the main thread is done
+        std::vector<std::thread> helpers;
+        for (size_t i = 1; i < m_workers.size(); ++i)
+        {
+            Worker& helper = *m_workers[i];
+            helpers.emplace_back([&helper, &position_, &history_]() { helper.run(position_, SearchLimits(), history_, nullptr); });
+        }
+
+        SearchResult result = m_workers.front()->run(position_, limits_, history_, onIteration_);
+
+        m_stopRequested = true;
+        for (auto& helper: helpers) helper.join();
+        result.m_nodes = countNodes();
+        return result;
+    }
+
+    void Search::clear()
+    {
+        m_table.clear();
+        for (auto& pWorker: m_workers) pWorker->clear();
+    }
+
+    uint64_t Search::countNodes() const
+    {
+        uint64_t nodes = 0;
+        for (const auto& pWorker: m_workers) nodes += pWorker->getNodes();
+        return nodes;
+    }
+}
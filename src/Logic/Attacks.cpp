@@ -0,0 +1,248 @@
+#include "../../include/Logic/Attacks.hpp"
+
+#include <cassert>
+
+namespace attacks
+{
+    Magic g_rookMagics[bitboard::g_NUMBER_OF_SQUARES];
+    Magic g_bishopMagics[bitboard::g_NUMBER_OF_SQUARES];
+    Bitboard g_knightAttacks[bitboard::g_NUMBER_OF_SQUARES];
+    Bitboard g_kingAttacks[bitboard::g_NUMBER_OF_SQUARES];
+    Bitboard g_pawnAttacks[2][bitboard::g_NUMBER_OF_SQUARES];
+    Bitboard g_between[bitboard::g_NUMBER_OF_SQUARES][bitboard::g_NUMBER_OF_SQUARES];
+    Bitboard g_line[bitboard::g_NUMBER_OF_SQUARES][bitboard::g_NUMBER_OF_SQUARES];
+}
+
+namespace
+{
+    // Sum over all squares of 2^(relevant bits)
+    constexpr int g_ROOK_TABLE_SIZE = 102400;
+    constexpr int g_BISHOP_TABLE_SIZE = 5248;
+
+    Bitboard g_rookTable[g_ROOK_TABLE_SIZE];
+    Bitboard g_bishopTable[g_BISHOP_TABLE_SIZE];
+
+    // Magic factors for the grid orientation (square 0 == a8). They were found
+    // offline with a sparse random search so that startup only fills the tables.
+    constexpr Bitboard g_ROOK_MAGIC_NUMBERS[bitboard::g_NUMBER_OF_SQUARES] = {
+        0x0080068051E04000ULL, 0x0040001000402000ULL, 0x0080100020008008ULL, 0x4E000A0010208440ULL,
+        0x4200040802002010ULL, 0x0100010008020400ULL, 0x9080608019000600ULL, 0x8100020080204100ULL,
+        0x4103800480400020ULL, 0x8015004004802100ULL, 0x000200108A002040ULL, 0x0801000821001000ULL,
+        0x0015000500080070ULL, 0x0120800400800200ULL, 0x0109000432001100ULL, 0x020080055B000080ULL,
+        0x0080004000402002ULL, 0x5260848020004008ULL, 0x2402020014402080ULL, 0x3000808010000802ULL,
+        0x0304018004810800ULL, 0x0000808004000200ULL, 0x0002040001500248ULL, 0x0012020000408401ULL,
+        0x8440008080004020ULL, 0x0804200840100040ULL, 0x0820008080201000ULL, 0x2080100100082100ULL,
+        0x0001000500100800ULL, 0x00A1000900028400ULL, 0x0100100400C80102ULL, 0x000001120000A044ULL,
+        0x800080C004800620ULL, 0x4040081000202000ULL, 0x0D08802008801000ULL, 0x1000800800801004ULL,
+        0x1004000801010010ULL, 0x0402800400800200ULL, 0x0004080204008110ULL, 0x0000404082000401ULL,
+        0x00C0118861408000ULL, 0x1100220081020048ULL, 0x09A0430420050010ULL, 0x0000082200420010ULL,
+        0x2110080004008080ULL, 0x2004201040680104ULL, 0x1106001451820008ULL, 0x0002224104820014ULL,
+        0x00800C8044210500ULL, 0x02A0200040100040ULL, 0x040100A0001E4100ULL, 0x00204023108A0200ULL,
+        0x2400080080040080ULL, 0x1289008400020900ULL, 0x0002088250010400ULL, 0x0001006084010200ULL,
+        0x0001023480002141ULL, 0x0006400021810015ULL, 0x8400100840200101ULL, 0x40003000A1000825ULL,
+        0x1002011008200402ULL, 0x100D000400080201ULL, 0x0020048806102904ULL, 0x8401000020804201ULL
+    };
+
+    constexpr Bitboard g_BISHOP_MAGIC_NUMBERS[bitboard::g_NUMBER_OF_SQUARES] = {
+        0x20400D0206044108ULL, 0x0410044090920000ULL, 0x0610008081092001ULL, 0x1110890208220101ULL,
+        0x0002021100001000ULL, 0x04A2080209000420ULL, 0x2402008248400020ULL, 0x1010104802082000ULL,
+        0x8120088268020428ULL, 0x2000484101120200ULL, 0x0805410101050A01ULL, 0x8000110400820081ULL,
+        0x1004040308000408ULL, 0x0044010108401108ULL, 0x00A1008410084488ULL, 0x0012811400820800ULL,
+        0x0008404010210202ULL, 0x0188100A3A283A04ULL, 0x181403C0840090C0ULL, 0x0001008824010000ULL,
+        0x4001008820081414ULL, 0x20BC400200422000ULL, 0x0026800328211010ULL, 0x0240200084040204ULL,
+        0x00025005A28C5004ULL, 0x040104C120088202ULL, 0xA9020E0001180200ULL, 0xB002002002008200ULL,
+        0x8101001001004000ULL, 0x0204820001012480ULL, 0x600B09400A180404ULL, 0x880D20C001005801ULL,
+        0x400C0241046004C4ULL, 0x00080A8810120800ULL, 0x1040805004010400ULL, 0x2000020080C80080ULL,
+        0x11004100408C0040ULL, 0x01010101000A0042ULL, 0x000828D180030804ULL, 0x0004010431024404ULL,
+        0x0442108221082820ULL, 0x1001041105002005ULL, 0x1001040206002302ULL, 0x000200C208000084ULL,
+        0x1000012012000101ULL, 0x000808100C10B020ULL, 0x0244040418486400ULL, 0x3002080500200302ULL,
+        0xA304040184104406ULL, 0xC01782080A02004AULL, 0x000082104208480DULL, 0x2208000420880108ULL,
+        0x0082024008220410ULL, 0x0400A00242020000ULL, 0x0008101108013000ULL, 0x00081248020A2090ULL,
+        0x2040820582204240ULL, 0x4006010082412012ULL, 0x1001080214840401ULL, 0x0000010020208820ULL,
+        0x800A4800A0043402ULL, 0x0104110842084200ULL, 0x000010A228090420ULL, 0x044061A802004040ULL
+    };
+
+    // {file, rank} increments
+    constexpr int g_ROOK_DIRECTIONS[4][2] = {{0, -1}, {0, 1}, {-1, 0}, {1, 0}};
+    constexpr int g_BISHOP_DIRECTIONS[4][2] = {{-1, -1}, {1, -1}, {-1, 1}, {1, 1}};
+    constexpr int g_KNIGHT_STEPS[8][2] = {{-2, -1}, {-2, 1}, {-1, -2}, {-1, 2}, {1, -2}, {1, 2}, {2, -1}, {2, 1}};
+    constexpr int g_KING_STEPS[8][2] = {{-1, -1}, {0, -1}, {1, -1}, {-1, 0}, {1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+    constexpr int g_WHITE_PAWN_STEPS[2][2] = {{-1, -1}, {1, -1}}; // White pawns move towards rank index 0
+    constexpr int g_BLACK_PAWN_STEPS[2][2] = {{-1, 1}, {1, 1}};
+
+    // xorshift64* generator used to draw random occupancies in selfCheck()
+    class PseudoRandom
+    {
+    public:
+        explicit PseudoRandom(uint64_t seed_): m_state(seed_) {}
+
+        uint64_t next()
+        {
+            m_state ^= m_state >> 12;
+            m_state ^= m_state << 25;
+            m_state ^= m_state >> 27;
+            return m_state * 2685821657736338717ULL;
+        }
+
+        uint64_t nextSparse() { return next() & next() & next(); }
+
+    private:
+        uint64_t m_state;
+    };
+
+    Bitboard walkRays(int square_, Bitboard occupancy_, const int directions_[4][2])
+    {
+        Bitboard attacks = bitboard::g_EMPTY;
+        for (int dir = 0; dir < 4; ++dir)
+        {
+            int file = bitboard::getFile(square_) + directions_[dir][0];
+            int rank = bitboard::getRank(square_) + directions_[dir][1];
+            while (file >= 0 && file < 8 && rank >= 0 && rank < 8)
+            {
+                const int square = bitboard::toSquare(file, rank);
+                attacks |= bitboard::squareMask(square);
+                if (bitboard::isSet(occupancy_, square)) break; // Blocked
+
+                file += directions_[dir][0];
+                rank += directions_[dir][1];
+            }
+        }
+        return attacks;
+    }
+
+    template <int N>
+    Bitboard collectSteps(int square_, const int (&steps_)[N][2])
+    {
+        Bitboard attacks = bitboard::g_EMPTY;
+        for (const auto& step: steps_)
+        {
+            const int file = bitboard::getFile(square_) + step[0];
+            const int rank = bitboard::getRank(square_) + step[1];
+            if (file >= 0 && file < 8 && rank >= 0 && rank < 8)
+                attacks |= bitboard::squareMask(bitboard::toSquare(file, rank));
+        }
+        return attacks;
+    }
+
+    void initLeapers()
+    {
+        for (int square = 0; square < bitboard::g_NUMBER_OF_SQUARES; ++square)
+        {
+            attacks::g_knightAttacks[square] = collectSteps(square, g_KNIGHT_STEPS);
+            attacks::g_kingAttacks[square] = collectSteps(square, g_KING_STEPS);
+            attacks::g_pawnAttacks[0][square] = collectSteps(square, g_WHITE_PAWN_STEPS);
+            attacks::g_pawnAttacks[1][square] = collectSteps(square, g_BLACK_PAWN_STEPS);
+        }
+    }
+
+    Bitboard getBoardEdges(int square_)
+    {
+        const Bitboard rank = bitboard::g_RANK_8 << (8 * bitboard::getRank(square_));
+        const Bitboard file = bitboard::g_FILE_A << bitboard::getFile(square_);
+        return ((bitboard::g_RANK_8 | bitboard::g_RANK_1) & ~rank) | ((bitboard::g_FILE_A | bitboard::g_FILE_H) & ~file);
+    }
+
+    void initMagics(
+        attacks::Magic magics_[],
+        const Bitboard magicNumbers_[],
+        Bitboard table_[],
+        int tableSize_,
+        const int directions_[4][2])
+    {
+        Bitboard* pSlice = table_;
+
+        for (int square = 0; square < bitboard::g_NUMBER_OF_SQUARES; ++square)
+        {
+            attacks::Magic& magic = magics_[square];
+            magic.m_mask = walkRays(square, bitboard::g_EMPTY, directions_) & ~getBoardEdges(square);
+            magic.m_magic = magicNumbers_[square];
+            magic.m_shift = bitboard::g_NUMBER_OF_SQUARES - bitboard::popCount(magic.m_mask);
+            magic.m_attacks = pSlice;
+
+            // Enumerate every subset of the mask (Carry-Rippler trick). Both
+            // indexing schemes map the subsets of a square onto [0, 2^bits).
+            int size = 0;
+            Bitboard subset = bitboard::g_EMPTY;
+            do
+            {
+                pSlice[magic.getIndex(subset)] = walkRays(square, subset, directions_);
+                ++size;
+                subset = (subset - magic.m_mask) & magic.m_mask;
+            } while (subset);
+
+            pSlice += size;
+            assert(pSlice - table_ <= tableSize_);
+        }
+    }
+
+    // Needs the slider tables to be filled
+    void initLines()
+    {
+        for (int from = 0; from < bitboard::g_NUMBER_OF_SQUARES; ++from)
+        {
+            const Bitboard fromMask = bitboard::squareMask(from);
+            for (int to = 0; to < bitboard::g_NUMBER_OF_SQUARES; ++to)
+            {
+                const Bitboard toMask = bitboard::squareMask(to);
+                attacks::g_between[from][to] = bitboard::g_EMPTY;
+                attacks::g_line[from][to] = bitboard::g_EMPTY;
+                if (from == to) continue;
+
+                if (attacks::getRookAttacks(from, bitboard::g_EMPTY) & toMask)
+                {
+                    attacks::g_between[from][to] = attacks::getRookAttacks(from, toMask) & attacks::getRookAttacks(to, fromMask);
+                    attacks::g_line[from][to] = (attacks::getRookAttacks(from, bitboard::g_EMPTY) & attacks::getRookAttacks(to, bitboard::g_EMPTY)) | fromMask | toMask;
+                }
+                else if (attacks::getBishopAttacks(from, bitboard::g_EMPTY) & toMask)
+                {
+                    attacks::g_between[from][to] = attacks::getBishopAttacks(from, toMask) & attacks::getBishopAttacks(to, fromMask);
+                    attacks::g_line[from][to] = (attacks::getBishopAttacks(from, bitboard::g_EMPTY) & attacks::getBishopAttacks(to, bitboard::g_EMPTY)) | fromMask | toMask;
+                }
+            }
+        }
+    }
+
+    struct AttackTablesInitializer
+    {
+        AttackTablesInitializer()
+        {
+            initLeapers();
+            initMagics(attacks::g_rookMagics, g_ROOK_MAGIC_NUMBERS, g_rookTable, g_ROOK_TABLE_SIZE, g_ROOK_DIRECTIONS);
+            initMagics(attacks::g_bishopMagics, g_BISHOP_MAGIC_NUMBERS, g_bishopTable, g_BISHOP_TABLE_SIZE, g_BISHOP_DIRECTIONS);
+            initLines();
+            assert(attacks::selfCheck());
+        }
+    };
+
+    // Builds the tables during static initialization, before main() runs
+    const AttackTablesInitializer g_attackTablesInitializer;
+}
+
+namespace attacks
+{
+    Bitboard getRookAttacksByRayWalk(int square_, Bitboard occupancy_)
+    {
+        return walkRays(square_, occupancy_, g_ROOK_DIRECTIONS);
+    }
+
+    Bitboard getBishopAttacksByRayWalk(int square_, Bitboard occupancy_)
+    {
+        return walkRays(square_, occupancy_, g_BISHOP_DIRECTIONS);
+    }
+
+    bool selfCheck(int occupanciesPerSquare_)
+    {
+        PseudoRandom prng(20240229);
+        for (int square = 0; square < bitboard::g_NUMBER_OF_SQUARES; ++square)
+        {
+            for (int i = 0; i < occupanciesPerSquare_; ++i)
+            {
+                // Alternate between dense and sparse occupancies
+                const Bitboard occupancy = (i % 2)? prng.next(): prng.nextSparse();
+                if (getRookAttacks(square, occupancy) != getRookAttacksByRayWalk(square, occupancy)) return false;
+                if (getBishopAttacks(square, occupancy) != getBishopAttacksByRayWalk(square, occupancy)) return false;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,519 @@
+#include "../../include/Logic/Board.hpp"
+#include "../../include/Logic/Pieces/Pawn.hpp"
+#include "../../include/Logic/Pieces/Rook.hpp"
+#include "../../include/Logic/Pieces/Piece.hpp"
+#include "../../include/Logic/Pieces/Knight.hpp"
+#include "../../include/Logic/Pieces/Bishop.hpp"
+#include "../../include/Logic/Pieces/King.hpp"
+#include "../../include/Logic/Pieces/Queen.hpp"
+#include "../../include/Logic/Move.hpp"
+#include "../../include/Logic/MoveGenerator.hpp"
+#include "../../include/Logic/TranspositionTable.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cassert>
+#include <sstream>
+
+namespace
+{
+    // Legal moves of recently seen positions, shared by every board. Going
+    // back and forth in the move tree revisits the same positions over and over.
+    constexpr size_t g_LEGAL_MOVE_CACHE_ENTRIES = 4096;
+
+    TranspositionTable<MoveList>& getLegalMoveCache()
+    {
+        static TranspositionTable<MoveList> legalMoveCache(g_LEGAL_MOVE_CACHE_ENTRIES);
+        return legalMoveCache;
+    }
+}
+
+Board::Board()
+{
+    reset();
+}
+
+void Board::reset()
+{
+    // Reset piece lists
+    m_whitePieces.clear();
+    m_blackPieces.clear();
+
+    // Set the kings
+    m_blackKing = std::make_shared<King>(Team::BLACK, 4, 0);
+    m_whiteKing = std::make_shared<King>(Team::WHITE, 4, 7);
+
+    // Set first row (black)
+    m_board[0][0] = std::make_shared<Rook>(Team::BLACK, 0, 0);
+    m_board[0][1] = std::make_shared<Knight>(Team::BLACK, 1, 0);
+    m_board[0][2] = std::make_shared<Bishop>(Team::BLACK, 2, 0);
+    m_board[0][3] = std::make_shared<Queen>(Team::BLACK, 3, 0);
+    m_board[0][4] = m_blackKing;
+    m_board[0][5] = std::make_shared<Bishop>(Team::BLACK, 5, 0);
+    m_board[0][6] = std::make_shared<Knight>(Team::BLACK, 6, 0);
+    m_board[0][7] = std::make_shared<Rook>(Team::BLACK, 7, 0);
+
+    // Set last row (white)
+    m_board[7][0] = std::make_shared<Rook>(Team::WHITE, 0, 7);
+    m_board[7][1] = std::make_shared<Knight>(Team::WHITE, 1, 7);
+    m_board[7][2] = std::make_shared<Bishop>(Team::WHITE, 2, 7);
+    m_board[7][3] = std::make_shared<Queen>(Team::WHITE, 3, 7);
+    m_board[7][4] = m_whiteKing;
+    m_board[7][5] = std::make_shared<Bishop>(Team::WHITE, 5, 7);
+    m_board[7][6] = std::make_shared<Knight>(Team::WHITE, 6, 7);
+    m_board[7][7] = std::make_shared<Rook>(Team::WHITE, 7, 7);
+
+    // Fill in white and black pawns
+    for (size_t file = 0; file < 8; ++file)
+    {
+        m_board[1][file] = std::make_shared<Pawn>(Team::BLACK, file, 1); // Black pawn on row 1
+        m_board[6][file] = std::make_shared<Pawn>(Team::WHITE, file, 6); // White pawn on row 6
+    }
+
+    // Add every black piece to the list of black pieces
+    for (size_t rank = 0; rank < 2; ++rank)
+        for (size_t file = 0; file < 8; ++file)
+            m_blackPieces.push_back(m_board[rank][file]);
+
+    // Add every white piece to the list of white pieces
+    for (size_t rank = 6; rank < 8; ++rank)
+        for (size_t file = 0; file < 8; ++file)
+            m_whitePieces.push_back(m_board[rank][file]);
+
+    // Delete pieces that have already moved
+    for (size_t rank = 0; rank < 8; ++rank)
+        for (size_t file = 2; file < 6; ++file)
+            m_board[file][rank].reset();
+
+    syncPositionWithBoardTiles();
+    m_position.setTurn(Team::WHITE); // Reset the first move to be for white
+    m_pLastMovedPiece.reset();
+    syncCastlingRightsAndEnPassant();
+    setIsKingChecked(false);
+    m_isFlipped = false;
+}
+
+Board::Board(const std::string& fen_)
+{
+    auto splitPosition = std::find_if(fen_.begin(), fen_.end(), ::isspace);
+    std::string position(fen_.begin(), splitPosition);
+    std::string remainingFEN(splitPosition, fen_.end());
+    
+    size_t rowIndex = 0, colIndex = 0;
+    for (const char& ch : position) 
+    {
+        if (ch == '/') 
+        {
+            ++rowIndex;
+            colIndex = 0;
+        } 
+        else if (std::isdigit(ch)) 
+        {
+            colIndex += ch - '0';
+        } 
+        else 
+        {
+            switch(ch) 
+            {
+                case 'r': m_board[rowIndex][colIndex] = std::make_shared<Rook>(Team::BLACK, colIndex, rowIndex); break;
+                case 'n': m_board[rowIndex][colIndex] = std::make_shared<Knight>(Team::BLACK, colIndex, rowIndex); break;
+                case 'b': m_board[rowIndex][colIndex] = std::make_shared<Bishop>(Team::BLACK, colIndex, rowIndex); break;
+                case 'q': m_board[rowIndex][colIndex] = std::make_shared<Queen>(Team::BLACK, colIndex, rowIndex); break;
+                case 'k': 
+                {
+                    m_blackKing = std::make_shared<King>(Team::BLACK, colIndex, rowIndex); 
+                    m_board[rowIndex][colIndex] = m_blackKing;
+                    break;
+                }
+                case 'p': m_board[rowIndex][colIndex] = std::make_shared<Pawn>(Team::BLACK, colIndex, rowIndex); break;
+                case 'R': m_board[rowIndex][colIndex] = std::make_shared<Rook>(Team::WHITE, colIndex, rowIndex); break;
+                case 'N': m_board[rowIndex][colIndex] = std::make_shared<Knight>(Team::WHITE, colIndex, rowIndex); break;
+                case 'B': m_board[rowIndex][colIndex] = std::make_shared<Bishop>(Team::WHITE, colIndex, rowIndex); break;
+                case 'Q': m_board[rowIndex][colIndex] = std::make_shared<Queen>(Team::WHITE, colIndex, rowIndex); break;
+                case 'K': 
+                {
+                    m_whiteKing = std::make_shared<King>(Team::WHITE, colIndex, rowIndex);
+                    m_board[rowIndex][colIndex] = m_whiteKing;
+                    break;
+                }
+                case 'P': m_board[rowIndex][colIndex] = std::make_shared<Pawn>(Team::WHITE, colIndex, rowIndex); break;
+                default: break;
+            }
+            if (m_board[rowIndex][colIndex]->getTeam() == Team::BLACK)
+                m_blackPieces.push_back(m_board[rowIndex][colIndex]);
+            else
+                m_whitePieces.push_back(m_board[rowIndex][colIndex]);
+
+            ++colIndex;
+        }
+    }
+
+    syncPositionWithBoardTiles();
+
+    // Remaining fields: side to move, castling rights, en passant square
+    std::istringstream fields(remainingFEN);
+    std::string turn, castling = "-", enPassant = "-";
+    fields >> turn >> castling >> enPassant;
+    m_position.setTurn(turn == "b" ? Team::BLACK : Team::WHITE);
+    applyFENCastlingRights(castling);
+    applyFENEnPassantSquare(enPassant);
+    syncCastlingRightsAndEnPassant();
+}
+
+namespace
+{
+    PieceType pieceTypeFromFEN(char c_)
+    {
+        switch (std::tolower(static_cast<unsigned char>(c_)))
+        {
+            case 'p': return PieceType::PAWN;
+            case 'n': return PieceType::KNIGHT;
+            case 'b': return PieceType::BISHOP;
+            case 'r': return PieceType::ROOK;
+            case 'q': return PieceType::QUEEN;
+            default: return PieceType::KING;
+        }
+    }
+
+    // Pieces beyond the initial set must have been promoted from missing pawns
+    bool hasPossibleMaterial(const Position& position_, Team team_)
+    {
+        auto count = [&position_, team_](PieceType type_) { return bitboard::popCount(position_.getPieces(team_, type_)); };
+        const int pawns = count(PieceType::PAWN);
+        const int promoted = std::max(count(PieceType::QUEEN) - 1, 0) +
+                             std::max(count(PieceType::ROOK) - 2, 0) +
+                             std::max(count(PieceType::BISHOP) - 2, 0) +
+                             std::max(count(PieceType::KNIGHT) - 2, 0);
+        return pawns <= 8 && promoted <= 8 - pawns;
+    }
+}
+
+std::string Board::checkFEN(std::string_view fen_)
+{
+    std::istringstream fields{std::string(fen_)};
+    std::string placement, turn, castling = "-", enPassant = "-";
+    fields >> placement >> turn >> castling >> enPassant;
+
+    Position position;
+    int rank = 0, file = 0;
+    int kingCounts[2] = {0, 0};
+    for (char c: placement)
+    {
+        if (c == '/')
+        {
+            if (file != 8) return "rank " + std::to_string(8 - rank) + " does not have 8 squares";
+            ++rank;
+            file = 0;
+            if (rank > 7) return "more than 8 ranks";
+            continue;
+        }
+        if (c >= '1' && c <= '8')
+        {
+            file += c - '0';
+        }
+        else
+        {
+            if (std::string_view("pnbrqkPNBRQK").find(c) == std::string_view::npos) return std::string("unknown piece '") + c + "'";
+            if ((c == 'p' || c == 'P') && (rank == 0 || rank == 7)) return "pawn on the first or last rank";
+            if (c == 'k' || c == 'K') ++kingCounts[(c == 'K')? 0: 1];
+            if (file < 8) position.setPiece(bitboard::toSquare(file, rank), std::isupper(static_cast<unsigned char>(c))? Team::WHITE: Team::BLACK, pieceTypeFromFEN(c));
+            ++file;
+        }
+        if (file > 8) return "rank " + std::to_string(8 - rank) + " has more than 8 squares";
+    }
+    if (rank != 7 || file != 8) return "the board does not have 8 ranks of 8 squares";
+    if (kingCounts[0] != 1 || kingCounts[1] != 1) return "each side needs exactly one king";
+    if (!hasPossibleMaterial(position, Team::WHITE) || !hasPossibleMaterial(position, Team::BLACK)) return "more pieces than promotions allow";
+
+    if (turn != "w" && turn != "b") return "side to move is not 'w' or 'b'";
+    if (castling != "-" && castling.find_first_not_of("KQkq") != std::string::npos) return "bad castling rights '" + castling + "'";
+    const bool isEnPassantSquare = enPassant.size() == 2 && enPassant[0] >= 'a' && enPassant[0] <= 'h' && (enPassant[1] == '3' || enPassant[1] == '6');
+    if (enPassant != "-" && !isEnPassantSquare) return "bad en passant square '" + enPassant + "'";
+
+    // The side that just moved cannot have left its king in check, which
+    // adjacent kings would also be
+    const Team toMove = (turn == "w")? Team::WHITE: Team::BLACK;
+    if (position.isSquareAttacked(position.getKingSquare(opponentOf(toMove)), toMove)) return "the side not to move is in check";
+    return std::string();
+}
+
+void Board::applyFENCastlingRights(const std::string& castling_)
+{
+    // Castling rights are derived from the moved flags of kings and rooks, so
+    // mark as moved the pieces whose right the FEN withholds
+    auto withholdRight = [this, &castling_](const std::shared_ptr<King>& pKing_, char right_, int rookFile_)
+    {
+        if (!pKing_ || castling_.find(right_) != std::string::npos) return;
+
+        const int homeRank = (pKing_->getTeam() == Team::WHITE)? 7: 0;
+        const auto& pRook = m_board[homeRank][rookFile_];
+        if (pRook && pRook->getType() == PieceType::ROOK && pRook->getTeam() == pKing_->getTeam())
+            pRook->setAsMoved();
+    };
+    withholdRight(m_whiteKing, 'K', 7);
+    withholdRight(m_whiteKing, 'Q', 0);
+    withholdRight(m_blackKing, 'k', 7);
+    withholdRight(m_blackKing, 'q', 0);
+
+    if (m_whiteKing && castling_.find_first_of("KQ") == std::string::npos) m_whiteKing->setAsMoved();
+    if (m_blackKing && castling_.find_first_of("kq") == std::string::npos) m_blackKing->setAsMoved();
+}
+
+void Board::applyFENEnPassantSquare(const std::string& enPassant_)
+{
+    if (enPassant_.size() != 2) return;
+
+    // The pawn that skipped the en passant square has just been moved
+    const int file = enPassant_[0] - 'a';
+    const int skippedRank = 8 - (enPassant_[1] - '0');
+    const int pawnRank = skippedRank + ((getTurn() == Team::WHITE)? 1: -1);
+    if (file < 0 || file > 7 || pawnRank < 0 || pawnRank > 7) return;
+
+    const auto& pPawn = m_board[pawnRank][file];
+    if (!pPawn || pPawn->getType() != PieceType::PAWN || pPawn->getTeam() == getTurn()) return;
+
+    setLastMovedPiece(pPawn);
+    setLastMoveType(MoveType::INIT_SPECIAL);
+}
+
+void Board::syncPositionWithBoardTiles()
+{
+    m_position.clear();
+    for (int rank = 0; rank < 8; ++rank)
+        for (int file = 0; file < 8; ++file)
+        {
+            const auto& pPiece = m_board[rank][file];
+            if (pPiece) m_position.setPiece(bitboard::toSquare(file, rank), pPiece->getTeam(), pPiece->getType());
+        }
+}
+
+std::shared_ptr<Move> Board::applyMoveOnBoard(
+    MoveType moveType_,
+    coor2d currPos_,
+    coor2d initialPos_,
+    const std::shared_ptr<Piece>& pSelectedPiece_,
+    const std::vector<Arrow>& arrows_)
+{
+    auto pMove = std::make_shared<Move>(
+        std::move(currPos_), 
+        std::move(initialPos_), 
+        pSelectedPiece_, 
+        moveType_);
+
+    pMove->setCapturedPiece(getLastMovedPiece());
+    pMove->setMoveArrows(arrows_);
+
+    return pMove; 
+}
+
+std::shared_ptr<Move> Board::applyMoveOnBoardTesting(
+    MoveType moveType_,
+    coor2d currPos_,
+    coor2d initialPos_,
+    const std::shared_ptr<Piece>& pSelectedPiece_,
+    PieceType promotion_)
+{
+    auto pMove = std::make_shared<Move>(
+        std::move(currPos_), 
+        std::move(initialPos_), 
+        pSelectedPiece_, 
+        moveType_);
+
+    pMove->setCapturedPiece(getLastMovedPiece());
+    pMove->setPromotion(promotion_);
+    return pMove; 
+}
+
+void Board::updateBoardInfosAfterNewMove(
+    const std::shared_ptr<Piece>& pSelectedPiece_,
+    const std::shared_ptr<Move>& pMove_)
+{
+    setLastMovedPiece(pSelectedPiece_);
+    setLastMoveType(pMove_->getMoveType());
+    switchTurn();
+    updateAllCurrentlyAvailableMoves();
+    
+    // It's better to have an explicit setter for this boolean instead
+    // of invoking getAllCUrrentlyAvailableMoves.empty() in the getter 
+    // because this function is suffiently expensive.
+    setAreThereNoMovesAvailableAtCurrentPosition(
+        getAllCurrentlyAvailableMoves().empty()
+    );
+    if (areThereNoMovesAvailableAtCurrentPosition()) pMove_->setNoMovesAvailable();
+
+    setIsKingChecked(kingIsChecked());
+    if (kingIsChecked()) pMove_->setChecked();
+}
+
+std::shared_ptr<Piece>& Board::getBoardTile(const std::pair<char, int>& coord_ /* <file, rank> : {'a', 2} */)  
+{
+    assert(coord_.second >= 1 && coord_.second <= 8);
+    assert(coord_.first >= 'a' && coord_.first <= 'h');
+
+    return m_board[8 - coord_.second][static_cast<int>(coord_.first - 'a')];
+}
+
+std::vector<Move> Board::possibleMovesFor(const std::shared_ptr<Piece>& piece)
+{
+    return piece->calcPossibleMoves(*this);
+}
+
+bool Board::kingIsChecked()
+{
+    return getKing()->isChecked(*this);
+}
+
+void Board::addPiece(const std::shared_ptr<Piece>& pPiece_)
+{
+    (pPiece_->getTeam() == Team::WHITE)? m_whitePieces.push_back(pPiece_)
+                                       : m_blackPieces.push_back(pPiece_);
+}
+
+const std::shared_ptr<King>& Board::getKing() const
+{
+    return (getTurn() == Team::WHITE)? m_whiteKing: m_blackKing;
+}
+
+void Board::setKingAsFirstMovement() 
+{
+    auto& king = (getTurn() == Team::WHITE)? m_whiteKing: m_blackKing;
+    king->setAsFirstMovement();
+}
+
+void Board::setBoardTile(int file_, int rank_, std::shared_ptr<Piece>& pPiece_, bool record_)
+{
+    if (record_ && m_board[rank_][file_])
+    {
+        m_board[rank_][file_]->move(-1, -1);
+    }
+    m_board[rank_][file_] = pPiece_;
+    if (pPiece_) pPiece_->move(rank_, file_, record_);
+
+    const int square = bitboard::toSquare(file_, rank_);
+    if (pPiece_) m_position.setPiece(square, pPiece_->getTeam(), pPiece_->getType());
+    else m_position.removePiece(square);
+}
+
+void Board::resetBoardTile(int file_, int rank_, bool record_)
+{
+    if (record_ && m_board[rank_][file_])
+    {
+        m_board[rank_][file_]->move(-1, -1);
+    }
+    m_board[rank_][file_].reset();
+    m_position.removePiece(bitboard::toSquare(file_, rank_));
+}
+
+void Board::updateAllCurrentlyAvailableMoves()
+{
+    syncCastlingRightsAndEnPassant();
+
+    TranspositionTable<MoveList>& legalMoveCache = getLegalMoveCache();
+    if (legalMoveCache.probe(m_position.getHash(), m_allCurrentlyAvailableMoves)) return;
+
+    m_allCurrentlyAvailableMoves.clear();
+    MoveGenerator(m_position).generateLegalMoves(m_allCurrentlyAvailableMoves);
+    legalMoveCache.store(m_position.getHash(), m_allCurrentlyAvailableMoves);
+}
+
+Move Board::toMove(CompactMove move_) const
+{
+    const coor2d init = move_.getInit();
+    const auto [targetFile, targetRank] = move_.getTarget();
+    const auto& pPiece = m_board[init.second][init.first];
+
+    switch (move_.getMoveType())
+    {
+        case MoveType::CAPTURE:
+            return Move({targetFile, targetRank}, init, pPiece, MoveType::CAPTURE, m_board[targetRank][targetFile]);
+        case MoveType::ENPASSANT:
+            // The taken pawn stands next to the capturing one
+            return Move({targetFile, targetRank}, init, pPiece, MoveType::ENPASSANT, m_board[init.second][targetFile]);
+        default:
+            return Move({targetFile, targetRank}, init, pPiece, move_.getMoveType());
+    }
+}
+
+bool Board::hasCastlingRight(const std::shared_ptr<King>& pKing_, int rookFile_) const
+{
+    // King and rook must both be on their initial squares and never have moved
+    const int homeRank = (pKing_->getTeam() == Team::WHITE)? 7: 0;
+    if (pKing_->hasMoved() || pKing_->getRank() != homeRank || pKing_->getFile() != 4) return false;
+
+    const auto& pRook = m_board[homeRank][rookFile_];
+    return pRook && pRook->getType() == PieceType::ROOK && pRook->getTeam() == pKing_->getTeam() && !pRook->hasMoved();
+}
+
+void Board::syncCastlingRightsAndEnPassant()
+{
+    uint8_t castlingRights = g_NO_CASTLING;
+    for (const auto& pKing: {m_whiteKing, m_blackKing})
+    {
+        if (!pKing) continue;
+        if (hasCastlingRight(pKing, 7)) castlingRights |= kingSideCastlingRight(pKing->getTeam());
+        if (hasCastlingRight(pKing, 0)) castlingRights |= queenSideCastlingRight(pKing->getTeam());
+    }
+    m_position.setCastlingRights(castlingRights);
+
+    // A pawn of the opponent that just moved two squares can be taken en passant
+    // on the square it skipped
+    int enPassantSquare = bitboard::g_NO_SQUARE;
+    const auto& pLastMovedPiece = getLastMovedPiece();
+    if (pLastMovedPiece && !pLastMovedPiece->isCached() &&
+        pLastMovedPiece->getType() == PieceType::PAWN &&
+        pLastMovedPiece->getLastMove() == MoveType::INIT_SPECIAL &&
+        pLastMovedPiece->getTeam() != getTurn() &&
+        m_board[pLastMovedPiece->getRank()][pLastMovedPiece->getFile()] == pLastMovedPiece)
+    {
+        const int skippedRank = pLastMovedPiece->getRank() + ((pLastMovedPiece->getTeam() == Team::WHITE)? 1: -1);
+        const int skippedSquare = bitboard::toSquare(pLastMovedPiece->getFile(), skippedRank);
+        if (m_position.canCaptureEnPassant(skippedSquare, getTurn())) enPassantSquare = skippedSquare;
+    }
+    m_position.setEnPassantSquare(enPassantSquare);
+}
+
+void Board::switchTurn()
+{
+    m_position.switchTurn();
+
+    // Rights and en passant depend on the move just played and on whose turn it is
+    syncCastlingRightsAndEnPassant();
+}
+
+uint64_t Board::hash() const
+{
+    assert(m_position.getHash() == m_position.computeHash());
+    return m_position.getHash();
+}
+
+void Board::checkIfMoveMakesKingChecked(const std::shared_ptr<Move>& move_)
+{
+    m_isKingChecked = move_ ? move_->kingIsChecked() : false;
+    m_currentlyNoMovesAvailable = move_ ? move_->hasNoMovesAvailable() : false;
+}
+
+std::optional<Move> Board::findSelectedMove(
+    const std::shared_ptr<Piece>& pSelectedPiece_, 
+    int file_,
+    int rank_ ) const
+{
+    const int from = bitboard::toSquare(pSelectedPiece_->getFile(), pSelectedPiece_->getRank());
+    const int to = bitboard::toSquare(file_, rank_);
+
+    // Promotions are listed with the queen first
+    for (auto move : getAllCurrentlyAvailableMoves())
+    {
+        if (move.getFrom() != from || move.getTo() != to) continue;
+
+        // The tile of a dragged piece is emptied, so bind the piece explicitly
+        Move selectedMove = toMove(move);
+        selectedMove.setSelectedPiece(pSelectedPiece_);
+        return selectedMove;
+    }
+    return std::nullopt;
+}
+
+void Board::printBoard() const 
+{
+    m_position.print();
+}
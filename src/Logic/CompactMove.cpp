@@ -0,0 +1,45 @@
+#include "../../include/Logic/CompactMove.hpp"
+
+int CompactMove::toKind(MoveType type_, PieceType promotion_)
+{
+    if (type_ != MoveType::NEWPIECE) return static_cast<int>(type_);
+
+    switch (promotion_)
+    {
+        case PieceType::ROOK: return g_UNDERPROMOTION_KIND;
+        case PieceType::BISHOP: return g_UNDERPROMOTION_KIND + 1;
+        case PieceType::KNIGHT: return g_UNDERPROMOTION_KIND + 2;
+        default: return static_cast<int>(MoveType::NEWPIECE);
+    }
+}
+
+PieceType CompactMove::getPromotion() const
+{
+    switch (getKind())
+    {
+        case g_UNDERPROMOTION_KIND: return PieceType::ROOK;
+        case g_UNDERPROMOTION_KIND + 1: return PieceType::BISHOP;
+        case g_UNDERPROMOTION_KIND + 2: return PieceType::KNIGHT;
+        default: return PieceType::QUEEN;
+    }
+}
+
+std::ostream& operator<<(std::ostream& os_, CompactMove move_)
+{
+    const auto [initFile, initRank] = move_.getInit();
+    const auto [targetFile, targetRank] = move_.getTarget();
+    os_ << static_cast<char>('a' + initFile) << 8 - initRank
+        << static_cast<char>('a' + targetFile) << 8 - targetRank;
+
+    if (move_.getMoveType() == MoveType::NEWPIECE)
+    {
+        switch (move_.getPromotion())
+        {
+            case PieceType::ROOK: os_ << 'r'; break;
+            case PieceType::BISHOP: os_ << 'b'; break;
+            case PieceType::KNIGHT: os_ << 'n'; break;
+            default: os_ << 'q'; break;
+        }
+    }
+    return os_;
+}
@@ -76,6 +76,7 @@ Move::Move(
     m_selectedPiece(move_.getSelectedPiece()), 
     m_capturedPiece(pSecondPiece_),
     m_MoveType(move_.getMoveType()), 
+    m_promotion(move_.getPromotion()),
     m_kingChecked(move_.m_kingChecked),
     m_noMovesAvailable(move_.m_noMovesAvailable)
 {
@@ -94,6 +95,7 @@ bool Move::operator==(const Move& other_)
 {
     return m_selectedPiece == other_.m_selectedPiece &&
     m_MoveType == other_.m_MoveType &&
+    m_promotion == other_.m_promotion &&
     m_target == other_.m_target &&
     m_init == other_.m_init &&
     m_enPassantInitialPos == other_.m_enPassantInitialPos;
@@ -112,11 +114,16 @@ std::pair<char, int> findLetterCoord(const coor2d& target_)
     return {letter, 8 - target_.second};
 }
 
-std::string parseMoveHelper(const Move& move_, int moveNumber_, bool showNumber_, bool showDots_) 
+std::string parseMoveNumber(int moveNumber_, bool showNumber_, bool showDots_)
 {
-    std::string text = (showNumber_)
+    return (showNumber_)
         ? std::to_string(moveNumber_) + "."
         : (showDots_)? std::to_string(moveNumber_-1) + "..." : "";
+}
+
+std::string parseMoveHelper(const Move& move_, int moveNumber_, bool showNumber_, bool showDots_) 
+{
+    std::string text = parseMoveNumber(moveNumber_, showNumber_, showDots_);
     MoveType moveType = move_.getMoveType();
 
     // Side cases
@@ -151,6 +158,22 @@ std::string parseMove(const Move& move_, int moveNumber_, bool showNumber_, bool
     return text;
 }
 
+std::string toLongAlgebraic(const Move& move_)
+{
+    const auto [initLetter, initRank] = findLetterCoord(move_.getInit());
+    const auto [targetLetter, targetRank] = findLetterCoord(move_.getTarget());
+    std::string text = initLetter + std::to_string(initRank) + targetLetter + std::to_string(targetRank);
+
+    if (move_.getMoveType() != MoveType::NEWPIECE) return text;
+    switch (move_.getPromotion())
+    {
+        case PieceType::ROOK: return text + 'r';
+        case PieceType::BISHOP: return text + 'b';
+        case PieceType::KNIGHT: return text + 'n';
+        default: return text + 'q';
+    }
+}
+
 std::ostream& operator<<(std::ostream& os_, const Move& move_)
 {
     return os_;
@@ -0,0 +1,222 @@
+#include "../../include/Logic/MoveGenerator.hpp"
+#include "../../include/Logic/Attacks.hpp"
+
+namespace
+{
+    // White pawns move towards rank index 0
+    int pawnDirection(Team team_) { return (team_ == Team::WHITE)? -1: 1; }
+    int pawnStartRank(Team team_) { return (team_ == Team::WHITE)? 6: 1; }
+    int promotionRank(Team team_) { return (team_ == Team::WHITE)? 0: 7; }
+    int kingHomeSquare(Team team_) { return (team_ == Team::WHITE)? bitboard::toSquare(4, 7): bitboard::toSquare(4, 0); }
+
+    constexpr PieceType g_PROMOTION_PIECES[] = {PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT};
+}
+
+MoveGenerator::MoveGenerator(const Position& position_):
+    m_position(position_),
+    m_us(position_.getTurn()),
+    m_them(opponentOf(position_.getTurn())),
+    m_kingSquare(position_.getKingSquare(position_.getTurn()))
+{
+    // Positions without a king (e.g. in piece tests) have no checks nor pins
+    if (m_kingSquare == bitboard::g_NO_SQUARE) return;
+
+    const Bitboard occupancy = m_position.getOccupancy();
+    const Bitboard theirQueens = m_position.getPieces(m_them, PieceType::QUEEN);
+    const Bitboard theirRooks = m_position.getPieces(m_them, PieceType::ROOK) | theirQueens;
+    const Bitboard theirBishops = m_position.getPieces(m_them, PieceType::BISHOP) | theirQueens;
+
+    m_checkers =
+        (attacks::getPawnAttacks(teamIndex(m_us), m_kingSquare) & m_position.getPieces(m_them, PieceType::PAWN)) |
+        (attacks::getKnightAttacks(m_kingSquare) & m_position.getPieces(m_them, PieceType::KNIGHT)) |
+        (attacks::getRookAttacks(m_kingSquare, occupancy) & theirRooks) |
+        (attacks::getBishopAttacks(m_kingSquare, occupancy) & theirBishops);
+
+    // A slider lined up with the king pins the only piece standing between them
+    Bitboard snipers =
+        (attacks::getRookAttacks(m_kingSquare, bitboard::g_EMPTY) & theirRooks) |
+        (attacks::getBishopAttacks(m_kingSquare, bitboard::g_EMPTY) & theirBishops);
+    while (snipers)
+    {
+        const int sniperSquare = bitboard::popLsb(snipers);
+        const Bitboard blockers = attacks::getBetween(m_kingSquare, sniperSquare) & occupancy;
+        if (bitboard::popCount(blockers) == 1 && (blockers & m_position.getOccupancy(m_us)))
+            m_pinned |= blockers;
+    }
+
+    // A single check is resolved by capturing the checker or blocking its ray.
+    // Against a double check only the king can move.
+    if (bitboard::popCount(m_checkers) == 1)
+    {
+        const int checkerSquare = bitboard::lsb(m_checkers);
+        m_checkMask = m_checkers | attacks::getBetween(m_kingSquare, checkerSquare);
+    }
+    else if (m_checkers)
+    {
+        m_checkMask = bitboard::g_EMPTY;
+    }
+}
+
+void MoveGenerator::generateLegalMoves(MoveList& moves_) const
+{
+    const Bitboard occupancy = m_position.getOccupancy();
+
+    Bitboard pieces = m_position.getOccupancy(m_us);
+    while (pieces)
+    {
+        const int from = bitboard::popLsb(pieces);
+        switch (m_position.getTypeAt(from))
+        {
+            case PieceType::PAWN:
+                addPawnMoves(from, moves_);
+                break;
+            case PieceType::KNIGHT:
+                addTargets(from, attacks::getKnightAttacks(from), moves_);
+                break;
+            case PieceType::BISHOP:
+                addTargets(from, attacks::getBishopAttacks(from, occupancy), moves_);
+                break;
+            case PieceType::ROOK:
+                addTargets(from, attacks::getRookAttacks(from, occupancy), moves_);
+                break;
+            case PieceType::QUEEN:
+                addTargets(from, attacks::getQueenAttacks(from, occupancy), moves_);
+                break;
+            case PieceType::KING:
+                addCastlingMoves(moves_);
+                addKingMoves(moves_);
+                break;
+        }
+    }
+}
+
+Bitboard MoveGenerator::getPinRay(int square_) const
+{
+    // A pinned piece may only slide along the line joining it to its king
+    return bitboard::isSet(m_pinned, square_)? attacks::getLine(m_kingSquare, square_): ~bitboard::g_EMPTY;
+}
+
+void MoveGenerator::addTargets(int from_, Bitboard targets_, MoveList& moves_) const
+{
+    targets_ &= ~m_position.getOccupancy(m_us) & m_checkMask & getPinRay(from_);
+    while (targets_)
+    {
+        const int to = bitboard::popLsb(targets_);
+        moves_.emplace_back(from_, to, m_position.isEmpty(to)? MoveType::NORMAL: MoveType::CAPTURE);
+    }
+}
+
+void MoveGenerator::addPawnMoves(int from_, MoveList& moves_) const
+{
+    // Edge case, should not happen
+    if (bitboard::getRank(from_) == promotionRank(m_us)) return;
+
+    const Bitboard allowed = m_checkMask & getPinRay(from_);
+    const int forward = 8 * pawnDirection(m_us);
+    const bool promotes = bitboard::getRank(from_) + pawnDirection(m_us) == promotionRank(m_us);
+
+    // Captures
+    Bitboard captures = attacks::getPawnAttacks(teamIndex(m_us), from_) & m_position.getOccupancy(m_them) & allowed;
+    while (captures)
+    {
+        const int to = bitboard::popLsb(captures);
+        addPawnMove(from_, to, promotes? MoveType::NEWPIECE: MoveType::CAPTURE, moves_);
+    }
+
+    // Forward moves
+    const int oneStep = from_ + forward;
+    if (m_position.isEmpty(oneStep))
+    {
+        if (bitboard::isSet(allowed, oneStep))
+            addPawnMove(from_, oneStep, promotes? MoveType::NEWPIECE: MoveType::NORMAL, moves_);
+
+        const int twoSteps = oneStep + forward;
+        if (bitboard::getRank(from_) == pawnStartRank(m_us) && m_position.isEmpty(twoSteps) && bitboard::isSet(allowed, twoSteps))
+            moves_.emplace_back(from_, twoSteps, MoveType::INIT_SPECIAL);
+    }
+
+    // En passant
+    const int enPassantSquare = m_position.getEnPassantSquare();
+    if (enPassantSquare != bitboard::g_NO_SQUARE &&
+        bitboard::isSet(attacks::getPawnAttacks(teamIndex(m_us), from_), enPassantSquare) &&
+        isEnPassantLegal(from_, enPassantSquare))
+    {
+        moves_.emplace_back(from_, enPassantSquare, MoveType::ENPASSANT);
+    }
+}
+
+void MoveGenerator::addPawnMove(int from_, int to_, MoveType type_, MoveList& moves_) const
+{
+    if (type_ != MoveType::NEWPIECE)
+    {
+        moves_.emplace_back(from_, to_, type_);
+        return;
+    }
+
+    for (PieceType promotion: g_PROMOTION_PIECES)
+        moves_.emplace_back(from_, to_, type_, promotion);
+}
+
+bool MoveGenerator::isEnPassantLegal(int from_, int to_) const
+{
+    if (m_kingSquare == bitboard::g_NO_SQUARE) return true;
+
+    // En passant removes two pieces from the rank of the capturing pawn, which
+    // may uncover a slider on the king even when the pawn itself is not pinned.
+    // Replay the capture on the occupancy and look for any attack on the king.
+    const int capturedSquare = bitboard::toSquare(bitboard::getFile(to_), bitboard::getRank(from_));
+    const Bitboard occupancy =
+        (m_position.getOccupancy() & ~bitboard::squareMask(from_) & ~bitboard::squareMask(capturedSquare)) |
+        bitboard::squareMask(to_);
+
+    const Bitboard theirQueens = m_position.getPieces(m_them, PieceType::QUEEN);
+    const Bitboard theirPawns = m_position.getPieces(m_them, PieceType::PAWN) & ~bitboard::squareMask(capturedSquare);
+
+    return !(attacks::getPawnAttacks(teamIndex(m_us), m_kingSquare) & theirPawns) &&
+           !(attacks::getKnightAttacks(m_kingSquare) & m_position.getPieces(m_them, PieceType::KNIGHT)) &&
+           !(attacks::getRookAttacks(m_kingSquare, occupancy) & (m_position.getPieces(m_them, PieceType::ROOK) | theirQueens)) &&
+           !(attacks::getBishopAttacks(m_kingSquare, occupancy) & (m_position.getPieces(m_them, PieceType::BISHOP) | theirQueens));
+}
+
+void MoveGenerator::addKingMoves(MoveList& moves_) const
+{
+    // The king itself must not block rays when looking at the squares it can step to
+    const Bitboard occupancyWithoutKing = m_position.getOccupancy() & ~bitboard::squareMask(m_kingSquare);
+
+    Bitboard targets = attacks::getKingAttacks(m_kingSquare) & ~m_position.getOccupancy(m_us);
+    while (targets)
+    {
+        const int to = bitboard::popLsb(targets);
+        if (m_position.isSquareAttacked(to, m_them, occupancyWithoutKing)) continue;
+        moves_.emplace_back(m_kingSquare, to, m_position.isEmpty(to)? MoveType::NORMAL: MoveType::CAPTURE);
+    }
+}
+
+void MoveGenerator::addCastlingMoves(MoveList& moves_) const
+{
+    // Cannot castle out of check, nor with a king away from its initial square
+    if (isInCheck() || m_kingSquare != kingHomeSquare(m_us)) return;
+
+    const Bitboard occupancy = m_position.getOccupancy();
+    const Bitboard ownRooks = m_position.getPieces(m_us, PieceType::ROOK);
+
+    // The squares between king and rook must be empty, and the king must not
+    // pass through or land on an attacked square
+    if (m_position.hasCastlingRight(kingSideCastlingRight(m_us)) &&
+        bitboard::isSet(ownRooks, m_kingSquare + 3) &&
+        !(attacks::getBetween(m_kingSquare, m_kingSquare + 3) & occupancy) &&
+        !m_position.isSquareAttacked(m_kingSquare + 1, m_them) &&
+        !m_position.isSquareAttacked(m_kingSquare + 2, m_them))
+    {
+        moves_.emplace_back(m_kingSquare, m_kingSquare + 2, MoveType::CASTLE_KINGSIDE);
+    }
+
+    if (m_position.hasCastlingRight(queenSideCastlingRight(m_us)) &&
+        bitboard::isSet(ownRooks, m_kingSquare - 4) &&
+        !(attacks::getBetween(m_kingSquare, m_kingSquare - 4) & occupancy) &&
+        !m_position.isSquareAttacked(m_kingSquare - 1, m_them) &&
+        !m_position.isSquareAttacked(m_kingSquare - 2, m_them))
+    {
+        moves_.emplace_back(m_kingSquare, m_kingSquare - 2, MoveType::CASTLE_QUEENSIDE);
+    }
+}
@@ -1,41 +1,196 @@
 #include "../../include/Logic/MoveTree.hpp"
 
+#include <cassert>
+
+MoveTree::MoveTree()
+{
+    clear();
+}
+
+void MoveTree::clear()
+{
+    // The arrays keep their capacity for the next game
+    m_nodes.assign(1, MoveTreeNode());
+    m_moves.assign(1, nullptr);
+    m_annotations.clear();
+    m_numberOfMoves = 0;
+    ++m_editCount;
+}
+
+NodeIndex MoveTree::getChild(NodeIndex node_, int i_) const
+{
+    assert(i_ >= 0 && i_ < static_cast<int>(m_nodes[node_].m_childCount));
+
+    NodeIndex child = m_nodes[node_].m_firstChild;
+    for (; i_ > 0; --i_) child = m_nodes[child].m_nextSibling;
+    return child;
+}
+
+std::string_view MoveTree::getSAN(NodeIndex node_) const
+{
+    const uint32_t san = m_nodes[node_].m_san;
+    return (san == g_NO_STRING)? std::string_view(): std::string_view(m_strings[san]);
+}
+
+void MoveTree::setSAN(NodeIndex node_, std::string_view san_)
+{
+    assert(node_ != g_ROOT);
+    m_nodes[node_].m_san = intern(san_);
+}
+
+uint32_t MoveTree::intern(std::string_view text_)
+{
+    const auto it = m_stringIds.find(text_);
+    if (it != m_stringIds.end()) return it->second;
+
+    const uint32_t id = static_cast<uint32_t>(m_strings.size());
+    m_strings.emplace_back(text_);
+    m_stringIds.emplace(m_strings.back(), id);
+    return id;
+}
+
+const MoveAnnotation* MoveTree::getAnnotation(NodeIndex node_) const
+{
+    const auto it = m_annotations.find(node_);
+    return (it == m_annotations.end())? nullptr: &it->second;
+}
+
+MoveAnnotation& MoveTree::annotate(NodeIndex node_)
+{
+    assert(node_ < m_nodes.size());
+    return m_annotations[node_];
+}
+
+// Appended as the last child of parent_
+NodeIndex MoveTree::addNode(NodeIndex parent_, const shared_ptr<Move>& move_)
+{
+    assert(m_nodes.size() < g_NO_NODE);
+    const NodeIndex node = static_cast<NodeIndex>(m_nodes.size());
+
+    MoveTreeNode& parent = m_nodes[parent_];
+    assert(parent.m_childCount < UINT16_MAX);
+
+    MoveTreeNode newNode;
+    newNode.m_parent = parent_;
+    newNode.m_depth = parent.m_depth + 1;
+    newNode.m_siblingIndex = parent.m_childCount;
+
+    ++parent.m_childCount;
+    if (parent.m_firstChild == g_NO_NODE)
+    {
+        parent.m_firstChild = node;
+    }
+    else
+    {
+        NodeIndex lastChild = parent.m_firstChild;
+        while (m_nodes[lastChild].m_nextSibling != g_NO_NODE) lastChild = m_nodes[lastChild].m_nextSibling;
+        m_nodes[lastChild].m_nextSibling = node;
+    }
+
+    // After the links, as parent may move with the arena
+    m_nodes.push_back(newNode);
+    m_moves.push_back(move_);
+    ++m_numberOfMoves;
+    return node;
+}
+
+// Takes node_ out of the children of its parent, leaving its subtree as is
+void MoveTree::unlinkNode(NodeIndex node_)
+{
+    MoveTreeNode& node = m_nodes[node_];
+    MoveTreeNode& parent = m_nodes[node.m_parent];
+
+    if (node.m_siblingIndex == 0) parent.m_firstChild = node.m_nextSibling;
+    else m_nodes[getChild(node.m_parent, node.m_siblingIndex - 1)].m_nextSibling = node.m_nextSibling;
+
+    node.m_nextSibling = g_NO_NODE;
+    --parent.m_childCount;
+}
+
+void MoveTree::renumberChildren(NodeIndex parent_)
+{
+    uint16_t i = 0;
+    for (NodeIndex child = m_nodes[parent_].m_firstChild; child != g_NO_NODE; child = m_nodes[child].m_nextSibling)
+        m_nodes[child].m_siblingIndex = i++;
+}
+
+void MoveTree::promoteVariation(const MoveTree::Iterator& it_)
+{
+    assert(it_.m_pTree == this && !it_.isAtTheBeginning());
+    const NodeIndex node = it_.m_index;
+    const NodeIndex parent = m_nodes[node].m_parent;
+    if (m_nodes[node].m_siblingIndex == 0) return;
+
+    unlinkNode(node);
+    m_nodes[node].m_nextSibling = m_nodes[parent].m_firstChild;
+    m_nodes[parent].m_firstChild = node;
+    ++m_nodes[parent].m_childCount;
+    renumberChildren(parent);
+    ++m_editCount;
+}
+
+void MoveTree::deleteVariation(MoveTree::Iterator& it_)
+{
+    assert(it_.m_pTree == this && !it_.isAtTheBeginning());
+    const NodeIndex node = it_.m_index;
+    const NodeIndex parent = m_nodes[node].m_parent;
+
+    unlinkNode(node);
+    renumberChildren(parent);
+
+    // The nodes stay in the arena until clear, without their moves
+    vector<NodeIndex> toRemove{node};
+    while (!toRemove.empty())
+    {
+        const NodeIndex removed = toRemove.back();
+        toRemove.pop_back();
+        for (NodeIndex child = m_nodes[removed].m_firstChild; child != g_NO_NODE; child = m_nodes[child].m_nextSibling)
+            toRemove.push_back(child);
+
+        m_moves[removed].reset();
+        m_annotations.erase(removed);
+        --m_numberOfMoves;
+    }
+    it_.m_index = parent;
+    ++m_editCount;
+}
+
 void MoveTree::insertNode(const shared_ptr<Move>& newMove_, MoveTree::Iterator& it_)
 {
-    for (int i = 0; i < it_->m_children.size(); ++i)
+    assert(it_.m_pTree == this);
+
+    for (NodeIndex child = it_->m_firstChild; child != g_NO_NODE; child = m_nodes[child].m_nextSibling)
     {
-        if (*it_->m_children[i]->m_move == *newMove_)
+        if (*m_moves[child] == *newMove_)
         {
-            it_.goToChild(i);
+            it_.m_index = child;
             return;
         }
     }
-    shared_ptr<MoveTreeNode> newNode = make_shared<MoveTreeNode>(newMove_); // Make new node with the move
-    it_.addChild(newNode);
-    ++numberOfMoves;
+    it_.m_index = addNode(it_.m_index, newMove_);
 }
 
 void MoveTree::goToNextNode(int slectedMoveIndex_, MoveTree::Iterator& it_)
 {
     // Go to next move only if it is not a Leaf node
-    if (!it_->m_children.empty())
+    if (!it_.isAtTheEnd())
         it_.goToChild(slectedMoveIndex_);
 }
 
 void MoveTree::goToPreviousNode(MoveTree::Iterator& it_)
 {
-    // Go to previous move only if it is not NULL
-    if (it_->m_parent) --it_;
+    // Go to previous move only if it is not the root
+    if (!it_.isAtTheBeginning()) --it_;
 }
 
 void MoveTree::printTreeRec(
-    shared_ptr<MoveTreeNode>& root_, 
+    NodeIndex node_, 
     vector<bool> flag_, 
     std::ostream& os_,
     int depth_, 
     bool isLast_) const
 {
-    if (!root_->m_move) return;
+    if (!m_moves[node_]) return;
 
     for (int i = 1; i < depth_; ++i)
     {
@@ -43,7 +198,7 @@ void MoveTree::printTreeRec(
         else os_ << " " << " " << " " << " ";
     }
 
-    coor2d tar = root_->m_move->getTarget();
+    coor2d tar = m_moves[node_]->getTarget();
     char file = static_cast<char>(tar.first + 'a');
     int rank = 8 - tar.second;
 
@@ -57,9 +212,8 @@ void MoveTree::printTreeRec(
     else
         os_ << "+--- " << "(" << file << "," << rank << ")" << '\n';
 
-    int it = 0;
-    for (auto i = root_->m_children.begin(); i != root_->m_children.end(); ++i, ++it)
-        printTreeRec(*i, flag_, os_, depth_ + 1, it == (root_->m_children.size()) - 1);
+    for (NodeIndex child = m_nodes[node_].m_firstChild; child != g_NO_NODE; child = m_nodes[child].m_nextSibling)
+        printTreeRec(child, flag_, os_, depth_ + 1, m_nodes[child].m_nextSibling == g_NO_NODE);
 
     flag_[depth_] = true;
 }
@@ -67,10 +221,9 @@ void MoveTree::printTreeRec(
 void MoveTree::printTree(std::ostream& os_) const
 {
     vector<bool> flag(getNumberOfMoves(), true);
-    if (m_root->m_children.size() == 0) return;
+    if (m_nodes[g_ROOT].m_childCount == 0) return;
     os_ << "===== Printing the move tree =====" << endl;
-    shared_ptr<MoveTreeNode> movePtr = m_root->m_children.at(0);
-    printTreeRec(movePtr, flag, os_);
+    printTreeRec(m_nodes[g_ROOT].m_firstChild, flag, os_);
 }
 
 std::string MoveTree::printTreeGet() const
@@ -80,31 +233,21 @@ std::string MoveTree::printTreeGet() const
     return oss.str();
 }
 
-void MoveTree::printPreorder(shared_ptr<MoveTreeNode>& m_root)
+void MoveTree::printPreorder(NodeIndex node_) const
 {
-    if (!m_root) return;
-
-    int i = 0;
-    shared_ptr<MoveTreeNode> temp;
-    coor2d tar = m_root->m_move->getTarget();
-    cout << " " << "(" << tar.first + 'a' << "," << 8 - tar.second << ")";
-    // Iterating the child of given node
-    while (i < m_root->m_children.size())
+    if (m_moves[node_])
     {
-        temp = m_root->m_children.at(i);
-        this->printPreorder(temp);
-        i++;
+        coor2d tar = m_moves[node_]->getTarget();
+        cout << " " << "(" << tar.first + 'a' << "," << 8 - tar.second << ")";
     }
+    // Iterating the child of given node
+    for (NodeIndex child = m_nodes[node_].m_firstChild; child != g_NO_NODE; child = m_nodes[child].m_nextSibling)
+        printPreorder(child);
 }
 
-int MoveTree::getNodeLevel(MoveTree::Iterator& it_)
+std::string parseMove(const MoveTree::Iterator& it_, int moveNumber_, bool showNumber_, bool showDots_)
 {
-    shared_ptr<MoveTreeNode> temp = it_.get();
-    int i = 0;
-    while (temp->m_parent)
-    {
-        temp = temp->m_parent;
-        ++i;
-    }
-    return i;
+    const std::string_view san = it_.getSAN();
+    if (san.empty()) return parseMove(*it_.getMove(), moveNumber_, showNumber_, showDots_);
+    return parseMoveNumber(moveNumber_, showNumber_, showDots_).append(san);
 }
@@ -94,15 +94,16 @@ void MoveTreeDisplayHandler::processNode(
     int& row_, 
     bool isNewLineSubvariation_) 
 {
-    auto* move = iter_->m_move.get();
+    auto* move = iter_.getMove().get();
     if (move == nullptr) return;
 
     MoveInfo info;
     const int nodeDepth = iter_.getNodeLevel();
-    info.m_content = parseMove(*move, nodeDepth / 2 + 1, nodeDepth % 2 != 0, isNewLineSubvariation_);
+    info.m_content = parseMove(iter_, nodeDepth / 2 + 1, nodeDepth % 2 != 0, isNewLineSubvariation_);
     info.m_indentLevel = level_;
     info.m_row = row_;
     info.m_movePtr = move;
+    info.m_node = iter_.getIndex();
 
     if (isNewLineSubvariation_)
     {
@@ -122,9 +123,9 @@ void MoveTreeDisplayHandler::processNodeRec(
     // If only 1 child go as usual
     // If more than one child, need to start with non-main line
 
-    if (iter_->m_children.size() < 2)
+    if (iter_.getChildCount() < 2)
     {
-        if (iter_->m_children.size() == 0) return;
+        if (iter_.getChildCount() == 0) return;
         iter_.goToChild(0);
         processNodeRec(iter_, level_, row_); 
         iter_.goToParent();
@@ -137,7 +138,7 @@ void MoveTreeDisplayHandler::processNodeRec(
         iter_.goToParent();
         
         // then loop over index 1 to N-1
-        for (size_t i = 1; i < iter_->m_children.size(); ++i) {
+        for (int i = 1; i < iter_.getChildCount(); ++i) {
             ++row_;
             iter_.goToChild(i);
             processNodeRec(iter_, level_ + 1, row_, true); 
@@ -155,24 +156,66 @@ void MoveTreeDisplayHandler::processNodeRec(
     }
 }
 
-std::vector<MoveInfo> MoveTreeDisplayHandler::generateMoveInfo() 
+const std::vector<MoveInfo>& MoveTreeDisplayHandler::generateMoveInfo() 
 {
-    if (m_tree.getNumberOfMoves() == 0) return {};
+    const size_t arenaSize = m_tree.getArenaSize();
+    const bool isOnlyGrown = m_isLaidOut && m_tree.getEditCount() == m_editCount;
+    if (isOnlyGrown && arenaSize == m_arenaSize) return m_moveInfos;
 
+    // New nodes come in the order they were inserted
+    bool isAppended = isOnlyGrown;
+    for (size_t node = m_arenaSize; isAppended && node < arenaSize; ++node)
+        isAppended = appendNode(static_cast<NodeIndex>(node));
+    if (!isAppended) rebuild();
+
+    m_isLaidOut = true;
+    m_arenaSize = arenaSize;
+    m_editCount = m_tree.getEditCount();
+    ++m_revision;
+    
+    //printMoves(m_moveInfos);
+    return m_moveInfos;
+}
+
+void MoveTreeDisplayHandler::rebuild()
+{
     m_moveInfos.clear();
+    ++m_rebuildCount;
 
     MoveTree::Iterator iter = m_tree.begin();
     int row = 0;
 
-    for (size_t i = 0; i < iter->m_children.size(); ++i)
+    for (int i = 0; i < iter.getChildCount(); ++i)
     {
         iter.goToChild(i);
         processNodeRec(iter, 0, row);
         iter.goToParent();
     }
-    
-    //printMoves(m_moveInfos);
-    return m_moveInfos;
+}
+
+// A move with no sibling, played after the move laid out last, simply comes
+// next on its row. False in every other case.
+bool MoveTreeDisplayHandler::appendNode(NodeIndex node_)
+{
+    const NodeIndex parent = m_tree.getNode(node_).m_parent;
+    if (m_tree.getNode(parent).m_childCount != 1) return false;
+
+    int level = 0;
+    int row = 0;
+    if (parent == MoveTree::g_ROOT)
+    {
+        if (!m_moveInfos.empty()) return false;
+    }
+    else
+    {
+        if (m_moveInfos.empty() || m_moveInfos.back().m_node != parent) return false;
+        level = m_moveInfos.back().m_indentLevel;
+        row = m_moveInfos.back().m_row;
+    }
+
+    MoveTree::Iterator iter(m_tree, node_);
+    processNode(iter, level, row);
+    return true;
 }
 
 std::string printMoveInfos(const std::vector<MoveInfo>& moveInfos_, bool printToConsole) 
@@ -1,7 +1,14 @@
 #include "../../include/Logic/MoveTreeManager.hpp"
 #include "../../include/Utilities/PieceTransition.hpp"
 #include "../../include/UI/UIConstants.hpp"
-#include "../../include/Application/GameThread.hpp"
+#include "../../include/Logic/Pieces/Pawn.hpp"
+#include "../../include/Logic/Pieces/King.hpp"
+#include "../../include/Logic/Pieces/Queen.hpp"
+#include "../../include/Logic/Pieces/Rook.hpp"
+#include "../../include/Logic/Pieces/Bishop.hpp"
+#include "../../include/Logic/Pieces/Knight.hpp"
+#include "../../include/Logic/MoveGenerator.hpp"
+#include "../../include/Logic/SAN.hpp"
 
 #include <cassert> 
 #include <iterator>
@@ -28,6 +35,36 @@ struct UndoRedoMoveInfo
     std::optional<std::shared_ptr<Piece>> m_castlingSecondPiece;
 };
 
+namespace
+{
+    // The legal move of position_ that move_ plays, or a null move
+    CompactMove findCompactMove(const Position& position_, const Move& move_)
+    {
+        const int from = bitboard::toSquare(move_.getInit().first, move_.getInit().second);
+        const int to = bitboard::toSquare(move_.getTarget().first, move_.getTarget().second);
+
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+        for (auto move: moves)
+        {
+            if (move.getFrom() != from || move.getTo() != to) continue;
+            if (move.getMoveType() != MoveType::NEWPIECE || move.getPromotion() == move_.getPromotion()) return move;
+        }
+        return CompactMove();
+    }
+
+    std::shared_ptr<Piece> makePromotedPiece(PieceType promotion_, Team team_, int file_, int rank_)
+    {
+        switch (promotion_)
+        {
+            case PieceType::ROOK: return std::make_shared<Rook>(team_, file_, rank_);
+            case PieceType::BISHOP: return std::make_shared<Bishop>(team_, file_, rank_);
+            case PieceType::KNIGHT: return std::make_shared<Knight>(team_, file_, rank_);
+            default: return std::make_shared<Queen>(team_, file_, rank_);
+        }
+    }
+}
+
 MoveTreeManager::MoveTreeManager(Board& board_): m_board(board_)
 {
 }
@@ -36,7 +73,9 @@ bool MoveTreeManager::goToPreviousMove(bool enableTransition_, vector<Arrow>& ar
 {
     if (!m_moveIterator.isAtTheBeginning())
     {
+        if (!m_positionHistory.empty()) m_positionHistory.pop_back();
         undoMove(enableTransition_, arrowList_);
+        restoreLastMovedPiece();
         m_board.switchTurn();
         m_board.updateAllCurrentlyAvailableMoves();
         
@@ -55,7 +94,9 @@ bool MoveTreeManager::goToNextMove(
         // Go to first children in the move list of the node, or at the specified index.
         m_moveIterator.goToChild(moveChildNumber_.value_or(0));
 
+        m_positionHistory.push_back(m_board.getPosition().getHash());
         applyMove(enableTransition_, arrowList_);
+        restoreLastMovedPiece();
         m_board.switchTurn();
         m_board.updateAllCurrentlyAvailableMoves();
 
@@ -64,16 +105,34 @@ bool MoveTreeManager::goToNextMove(
     return false;
 }
 
+void MoveTreeManager::restoreLastMovedPiece()
+{
+    // The en passant square, and so the board hash, depend on the move that
+    // led to the current node
+    const auto& pMove = m_moveIterator.getMove();
+    m_board.setLastMovedPiece(pMove? pMove->getSelectedPiece(): nullptr);
+    if (pMove) m_board.setLastMoveType(pMove->getMoveType());
+}
+
 void MoveTreeManager::addMove(const shared_ptr<Move>& move_, vector<Arrow>& arrowList_)
 {
+    if (!move_) return;
+
+    // The notation depends on the position the move is played from
+    const Position position = m_board.getPosition();
+    m_positionHistory.push_back(position.getHash());
     applyMove(move_, true, true, arrowList_);
+    if (!m_moveIterator.getSAN().empty()) return; // Already played from here
+
+    const CompactMove move = findCompactMove(position, *move_);
+    if (!move.isNull()) m_moves.setSAN(m_moveIterator.getIndex(), san::toSAN(position, move));
 }
 
 void MoveTreeManager::applyMove(
     bool enableTransition_, 
     vector<Arrow>& arrowList_)
 {
-    applyMove(m_moveIterator->m_move, false, enableTransition_, arrowList_);
+    applyMove(m_moveIterator.getMove(), false, enableTransition_, arrowList_);
 }
 
 void MoveTreeManager::handleRedoMoveNormal( UndoRedoMoveInfo& undoRedoMoveInfo_, bool addToList_)
@@ -171,11 +230,12 @@ void MoveTreeManager::handleRedoMoveNewPiece(UndoRedoMoveInfo& undoRedoMoveInfo_
     auto& pSelectedPiece = undoRedoMoveInfo_.m_selectedPiece;
     auto pCapturedPiece = m_board.getBoardTile(undoRedoMoveInfo_.m_targetFile, undoRedoMoveInfo_.m_targetRank);
 
-    std::shared_ptr<Piece> pPromotingPiece = make_shared<Queen>(
+    std::shared_ptr<Piece> pPromotingPiece = makePromotedPiece(
+        undoRedoMoveInfo_.m_move->getPromotion(),
         undoRedoMoveInfo_.m_selectedPiece->getTeam(), 
         undoRedoMoveInfo_.m_targetFile, 
         undoRedoMoveInfo_.m_targetRank);
-    Piece::setLastMovedPiece(pPromotingPiece);
+    m_board.setLastMovedPiece(pPromotingPiece);
     m_board.setBoardTile(undoRedoMoveInfo_.m_targetFile, undoRedoMoveInfo_.m_targetRank, pPromotingPiece);
     m_board.addPiece(pPromotingPiece);
 
@@ -340,8 +400,7 @@ void MoveTreeManager::handleUndoMoveInitSpecial(UndoRedoMoveInfo& undoRedoMoveIn
 
 void MoveTreeManager::handleUndoMoveNewPiece(UndoRedoMoveInfo& undoRedoMoveInfo_)
 {
-    auto& pCapturePiece = undoRedoMoveInfo_.m_capturedPiece;
-    assert(pCapturePiece);
+    auto& pCapturePiece = undoRedoMoveInfo_.m_capturedPiece; // Null unless the pawn captured
 
     shared_ptr<Piece> pNewPawn = make_shared<Pawn>(
         undoRedoMoveInfo_.m_selectedPiece->getTeam(),
@@ -362,7 +421,7 @@ void MoveTreeManager::executeUndoRedoHandler(
 
 void MoveTreeManager::undoMove(bool enableTransition_, vector<Arrow>& arrowList_)
 {
-    shared_ptr<Move> move = m_moveIterator->m_move;
+    shared_ptr<Move> move = m_moveIterator.getMove();
     if (!move) return;
     
     arrowList_ = move->getMoveArrows();
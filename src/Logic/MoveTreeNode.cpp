@@ -1,5 +0,0 @@
-#include "../../include/Logic/MoveTreeNode.hpp"
-
-MoveTreeNode::MoveTreeNode(const std::shared_ptr<Move>& move_): m_move(move_)
-{
-}
@@ -0,0 +1,187 @@
+#include "../../include/Logic/Perft.hpp"
+#include "../../include/Logic/MoveGenerator.hpp"
+#include "../../include/Utilities/WorkStealingPool.hpp"
+
+#include <cassert>
+
+namespace
+{
+    // Subtree left to count, credited to the root move it descends from
+    struct SubtreeTask
+    {
+        size_t m_rootIndex;
+        Position m_position;
+        int m_depth;
+    };
+
+    // Enough tasks per thread for stealing to even out their different sizes
+    constexpr size_t g_TASKS_PER_THREAD = 16;
+
+    // Shallower subtrees are cheaper to count than to hand over to a thread
+    constexpr int g_MIN_SPLIT_DEPTH = 3;
+
+    // Distinguishes the counts of one position at different depths
+    uint64_t nodeCountKey(const Position& position_, int depth_)
+    {
+        return position_.getHash() ^ (static_cast<uint64_t>(depth_) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    // Replaces tasks by the subtrees of their moves, one ply at a time, until
+    // there are enough of them or none is worth splitting anymore
+    std::vector<SubtreeTask> expandFrontier(std::vector<SubtreeTask> tasks_, size_t targetSize_)
+    {
+        bool expanded = true;
+        while (expanded && tasks_.size() < targetSize_)
+        {
+            expanded = false;
+            std::vector<SubtreeTask> frontier;
+            for (auto& task: tasks_)
+            {
+                if (task.m_depth < g_MIN_SPLIT_DEPTH)
+                {
+                    frontier.push_back(std::move(task));
+                    continue;
+                }
+
+                MoveList moves;
+                MoveGenerator(task.m_position).generateLegalMoves(moves);
+                for (auto move: moves)
+                {
+                    Position child = task.m_position;
+                    child.makeMove(move);
+                    frontier.push_back({task.m_rootIndex, child, task.m_depth - 1});
+                }
+                expanded = true;
+            }
+            tasks_ = std::move(frontier);
+        }
+        return tasks_;
+    }
+}
+
+namespace perft
+{
+    uint64_t countNodes(const Position& position_, int depth_)
+    {
+        if (depth_ <= 0) return 1;
+
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+
+        // Leaves do not need to be played, counting them is enough
+        if (depth_ == 1) return moves.size();
+
+        uint64_t nodes = 0;
+        for (auto move: moves)
+        {
+            Position child = position_;
+            child.makeMove(move);
+            nodes += countNodes(child, depth_ - 1);
+        }
+        return nodes;
+    }
+
+    uint64_t countNodes(const Position& position_, int depth_, NodeCountTable& table_)
+    {
+        // Shallow subtrees are cheaper to count again than to look up
+        if (depth_ <= 1) return countNodes(position_, depth_);
+
+        const uint64_t key = nodeCountKey(position_, depth_);
+        uint64_t nodes = 0;
+        if (table_.probe(key, nodes)) return nodes;
+
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+        for (auto move: moves)
+        {
+            Position child = position_;
+            child.makeMove(move);
+            nodes += countNodes(child, depth_ - 1, table_);
+        }
+
+        table_.store(key, nodes);
+        return nodes;
+    }
+
+    Divide divide(const Position& position_, int depth_)
+    {
+        assert(depth_ >= 1);
+
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+
+        Divide nodesPerMove;
+        for (auto move: moves)
+        {
+            Position child = position_;
+            child.makeMove(move);
+            nodesPerMove.emplace_back(move, countNodes(child, depth_ - 1));
+        }
+        return nodesPerMove;
+    }
+
+    uint64_t countNodesParallel(const Position& position_, int depth_, unsigned threadCount_, NodeCountTable* pTable_)
+    {
+        if (depth_ <= 0) return 1;
+
+        uint64_t nodes = 0;
+        for (const auto& [move, moveNodes]: divideParallel(position_, depth_, threadCount_, pTable_)) nodes += moveNodes;
+        return nodes;
+    }
+
+    Divide divideParallel(const Position& position_, int depth_, unsigned threadCount_, NodeCountTable* pTable_)
+    {
+        assert(depth_ >= 1);
+
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+
+        Divide nodesPerMove;
+        std::vector<SubtreeTask> tasks;
+        for (auto move: moves)
+        {
+            Position child = position_;
+            child.makeMove(move);
+            tasks.push_back({nodesPerMove.size(), child, depth_ - 1});
+            nodesPerMove.emplace_back(move, 0);
+        }
+
+        WorkStealingPool pool(threadCount_);
+        tasks = expandFrontier(std::move(tasks), pool.getThreadCount() * g_TASKS_PER_THREAD);
+
+        // Each task writes its own slot, the sums are made once all are done
+        std::vector<uint64_t> taskNodes(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i)
+        {
+            pool.submit([&tasks, &taskNodes, i, pTable_] {
+                const SubtreeTask& task = tasks[i];
+                taskNodes[i] = pTable_? countNodes(task.m_position, task.m_depth, *pTable_)
+                                      : countNodes(task.m_position, task.m_depth);
+            });
+        }
+        pool.wait();
+
+        for (size_t i = 0; i < tasks.size(); ++i) nodesPerMove[tasks[i].m_rootIndex].second += taskNodes[i];
+        return nodesPerMove;
+    }
+
+    const std::vector<ReferencePosition>& getReferencePositions()
+    {
+        // From the Chess Programming Wiki "Perft Results" page
+        static const std::vector<ReferencePosition> referencePositions{
+            {"Initial position", "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+                {20, 400, 8902, 197281, 4865609, 119060324}},
+            {"Kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+                {48, 2039, 97862, 4085603, 193690690}},
+            {"Position 3", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+                {14, 191, 2812, 43238, 674624, 11030083}},
+            {"Position 4", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1",
+                {6, 264, 9467, 422333, 15833292}},
+            {"Position 5", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8",
+                {44, 1486, 62379, 2103487, 89941194}},
+            {"Position 6", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10",
+                {46, 2079, 89890, 3894594, 164075551}}
+        };
+        return referencePositions;
+    }
+}
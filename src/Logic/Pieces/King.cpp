@@ -20,6 +20,7 @@ std::vector<Move> King::calcPossibleMoves(Board& board_) const
     int file = getFile();
     coor2d kingCoor = {file, rank};
     std::shared_ptr<Piece> kingPtr = board_.getBoardTile(file, rank);
+    const Position& position = board_.getPosition();
 
     // Checking castling
     if (canCastleKingSide(board_))
@@ -27,6 +28,10 @@ std::vector<Move> King::calcPossibleMoves(Board& board_) const
     if (canCastleQueenSide(board_))
         moves.push_back(Move({2, rank}, kingCoor, kingPtr, MoveType::CASTLE_QUEENSIDE));
 
+    // The king itself must not block rays when looking at the squares it can step to
+    const Team opponent = opponentOf(getTeam());
+    const Bitboard occupancyWithoutKing = position.getOccupancy() & ~bitboard::squareMask(bitboard::toSquare(file, rank));
+
     for (int i = std::max(0, rank-1); i <= std::min(7, rank+1); ++i)
     {
         for (int j = std::max(0, file-1); j <= std::min(7, file+1); ++j)
@@ -35,75 +40,21 @@ std::vector<Move> King::calcPossibleMoves(Board& board_) const
             if (rank == i && file == j) continue;
 
             // If position is empty or piece on it is of the opposite colour
-            std::shared_ptr<Piece> piece = board_.getBoardTile(j, i);
-            if (!piece || piece->getTeam() != getTeam())
-            {
-                // Move king to test
-                board_.resetBoardTile(file, rank, false);
-                board_.setBoardTile(j, i, kingPtr, false);
-
-                // Check if king is checked in this position
-                bool checked = isChecked(board_);
-
-                // Put king back
-                board_.setBoardTile(file, rank, kingPtr, false);
-                board_.setBoardTile(j, i, piece, false);
-
-                // If king is not checked, we can add move
-                if (!checked)
-                {
-                    if (!piece) moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::NORMAL));
-                    else moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::CAPTURE));
-                }
-            }
-        }
-    }
-    return moves;
-}
+            const int square = bitboard::toSquare(j, i);
+            if (!position.isEmpty(square) && position.getTeamAt(square) == getTeam()) continue;
 
-std::vector<Move> King::possibleMovesNoCheck(Board& board_) const {
-    std::vector<Move> moves;
-    int rank = getRank();
-    int file = getFile();
-    coor2d kingCoor = {file, rank};
-    std::shared_ptr<Piece> kingPtr = board_.getBoardTile(file, rank);
+            // King cannot step onto an attacked square
+            if (position.isSquareAttacked(square, opponent, occupancyWithoutKing)) continue;
 
-    for (int i = std::max(0, rank-1); i <= std::min(7, rank+1); ++i) {
-        for (int j = std::max(0, file-1); j <= std::min(7, file+1); ++j) {
-            // King cannot stay in same place
-            if (rank == i && file == j) continue;
-
-            // If position is empty or piece on it is of the opposite colour
-            if (!board_.getBoardTile(j, i) || board_.getBoardTile(j, i)->getTeam() != getTeam()) {
-                if (!board_.getBoardTile(j, i)) moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::NORMAL));
-                else moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::CAPTURE));
-            }
+            if (position.isEmpty(square)) moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::NORMAL));
+            else moves.push_back(Move({j, i}, kingCoor, kingPtr, MoveType::CAPTURE));
         }
     }
     return moves;
 }
 
 bool King::isChecked(Board& board_) const {
-    // Looping through everfile piece
-    for (size_t row = 0; row < 8; ++row) {
-        for (size_t col = 0; col < 8; ++col) {
-            std::shared_ptr<Piece> p = board_.getBoardTile(col, row);
-
-            // If piece has opposite colour, it is a potential danger
-            if (p && p->getTeam() != getTeam()) {
-                std::vector<Move> positions = (p->getType() == PieceType::KING)?
-                    ((King*) p.get())->possibleMovesNoCheck(board_): p->calcPossibleMoves(board_);
-
-                // Loop through every possible move to see if king is in danger or not
-                for (auto& move: positions)
-                    if (move.getTarget().first == getFile() && move.getTarget().second == getRank())
-                        return true;
-            }
-        }
-    }
-
-    // No checks found
-    return false;
+    return board_.getPosition().isSquareAttacked(bitboard::toSquare(getFile(), getRank()), opponentOf(getTeam()));
 }
 
 bool King::canCastleKingSide(Board& board_) const {
@@ -125,15 +76,10 @@ bool King::canCastleKingSide(Board& board_) const {
         return false;
 
     // If we traverse a check, forget it
-    bool traversesCheck = false;
-    swapPieces(board_, rank, file, rank, file + 1); // Move king one place to the left
-    if (isChecked(board_)) traversesCheck = true;
-
-    swapPieces(board_, rank, file + 1, rank, file + 2); // Move king two places to the left
-    if (isChecked(board_)) traversesCheck = true;
-
-    swapPieces(board_, rank, file + 2, rank, file); // Put king back
-    return !traversesCheck;
+    const Position& position = board_.getPosition();
+    const Team opponent = opponentOf(getTeam());
+    return !position.isSquareAttacked(bitboard::toSquare(file + 1, rank), opponent) &&
+           !position.isSquareAttacked(bitboard::toSquare(file + 2, rank), opponent);
 }
 
 bool King::canCastleQueenSide(Board& board_) const {
@@ -155,13 +101,8 @@ bool King::canCastleQueenSide(Board& board_) const {
         return false;
 
     // If we traverse a check, forget it
-    bool traversesCheck = false;
-    swapPieces(board_, rank, file, rank, file - 1); // Move king one place to the left
-    if (isChecked(board_)) traversesCheck = true;
-
-    swapPieces(board_, rank, file - 1, rank, file - 2); // Move king two places to the left
-    if (isChecked(board_)) traversesCheck = true;
-
-    swapPieces(board_, rank, file - 2, rank, file); // Put king back
-    return !traversesCheck;
+    const Position& position = board_.getPosition();
+    const Team opponent = opponentOf(getTeam());
+    return !position.isSquareAttacked(bitboard::toSquare(file - 1, rank), opponent) &&
+           !position.isSquareAttacked(bitboard::toSquare(file - 2, rank), opponent);
 }
@@ -25,6 +25,9 @@ std::vector<Move> Knight::calcPossibleMoves(Board& board_) const
     int dx[8] = {2, 1, -1, -2, -2, -1, 1, 2};
     int dy[8] = {1, 2, 2, 1, -1, -2, -2, -1};
 
+    const Position& position = board_.getPosition();
+    std::shared_ptr<Piece> p = board_.getBoardTile(file, rank);
+
     for (int i = 0; i < 8; ++i)
     {
         int newRank = rank + dx[i];
@@ -32,10 +35,10 @@ std::vector<Move> Knight::calcPossibleMoves(Board& board_) const
 
         if (newRank >= 0 && newFile >= 0 && newRank < 8 && newFile < 8)
         {
-            std::shared_ptr<Piece> p = board_.getBoardTile(file, rank);
-            if (!board_.getBoardTile(newFile, newRank))
+            const int square = bitboard::toSquare(newFile, newRank);
+            if (position.isEmpty(square))
                 moves.push_back(Move({newFile, newRank}, {file, rank}, p, MoveType::NORMAL));
-            else if (board_.getBoardTile(newFile, newRank)->getTeam() != getTeam())
+            else if (position.getTeamAt(square) != getTeam())
                 moves.push_back(Move({newFile, newRank}, {file, rank}, p, MoveType::CAPTURE));
         }
     }
@@ -28,16 +28,32 @@ std::vector<Move> Pawn::calcPossibleMoves(Board& board_) const
     return moves;
 }
 
+namespace
+{
+    bool isOpponentPieceAt(const Position& position_, int file_, int rank_, Team team_)
+    {
+        const int square = bitboard::toSquare(file_, rank_);
+        return !position_.isEmpty(square) && position_.getTeamAt(square) != team_;
+    }
+
+    bool isOpponentPawnAt(const Position& position_, int file_, int rank_, Team team_)
+    {
+        return isOpponentPieceAt(position_, file_, rank_, team_) && 
+               position_.getTypeAt(bitboard::toSquare(file_, rank_)) == PieceType::PAWN;
+    }
+}
+
 void Pawn::generateCaptureMoves(std::vector<Move>& moves_, Board& board_, int dir_) const
 {
     int rank = getRank();
     int file = getFile();
     coor2d pawnCoor = {file, rank};
     std::shared_ptr<Piece> pPawnPos = board_.getBoardTile(file, rank);
+    const Position& position = board_.getPosition();
 
     // Taking piece on the right
     if (file+1 < 8 && (rank+dir_ < 8 && rank+dir_ >= 0))
-        if (board_.getBoardTile(file+1, rank+dir_) && board_.getBoardTile(file+1, rank+dir_)->getTeam() != getTeam())
+        if (isOpponentPieceAt(position, file+1, rank+dir_, getTeam()))
         {
             if ((rank+dir_ == 0 || rank+dir_ == 7))
                 moves_.push_back(Move({file+1, rank+dir_}, pawnCoor, pPawnPos, MoveType::NEWPIECE));
@@ -47,7 +63,7 @@ void Pawn::generateCaptureMoves(std::vector<Move>& moves_, Board& board_, int di
 
     // Taking piece on the left
     if (file-1 >= 0 && (rank+dir_ < 8 && rank+dir_ >= 0))
-        if (board_.getBoardTile(file-1, rank+dir_) && board_.getBoardTile(file-1, rank+dir_)->getTeam() != getTeam())
+        if (isOpponentPieceAt(position, file-1, rank+dir_, getTeam()))
         {
             if ((rank+dir_ == 0 || rank+dir_ == 7))
                 moves_.push_back(Move({file-1, rank+dir_}, pawnCoor, pPawnPos, MoveType::NEWPIECE));
@@ -62,16 +78,18 @@ void Pawn::generateForwardMoves(std::vector<Move>& moves_, Board& board_, int di
     int file = getFile();
     coor2d pawnCoor = {file, rank};
     std::shared_ptr<Piece> pPawnPos = board_.getBoardTile(file, rank);
+    const Position& position = board_.getPosition();
     bool hasNotMoved = (getTeam() == Team::WHITE && rank == 6) || (getTeam() == Team::BLACK && rank == 1);
 
     // Forward move
-    if ((rank+dir_ == 0 || rank+dir_ == 7) && !board_.getBoardTile(file, rank+dir_))
+    const bool isForwardSquareEmpty = position.isEmpty(bitboard::toSquare(file, rank+dir_));
+    if ((rank+dir_ == 0 || rank+dir_ == 7) && isForwardSquareEmpty)
         moves_.push_back(Move({file, rank+dir_}, pawnCoor, pPawnPos, MoveType::NEWPIECE));
-    else if (!board_.getBoardTile(file, rank+dir_))
+    else if (isForwardSquareEmpty)
     {
         moves_.push_back(Move({file, rank+dir_}, pawnCoor, pPawnPos, MoveType::NORMAL));
         // Double square initial move
-        if (hasNotMoved && !board_.getBoardTile(file, rank+2*dir_))
+        if (hasNotMoved && position.isEmpty(bitboard::toSquare(file, rank+2*dir_)))
             moves_.push_back(Move({file, rank+2*dir_}, pawnCoor, pPawnPos, MoveType::INIT_SPECIAL));
     }
 }
@@ -82,33 +100,28 @@ void Pawn::generateEnPassantMoves(std::vector<Move>& moves_, Board& board_, int
     int file = getFile();
     coor2d pawnCoor = {file, rank};
     std::shared_ptr<Piece> pPawnPos = board_.getBoardTile(file, rank);
+    const Position& position = board_.getPosition();
 
     // Edge case, should not happen
     if (rank+dir < 0 || rank+dir > 7) return;
 
     // Left En Passant
-    if (file > 0)
+    if (file > 0 && isOpponentPawnAt(position, file-1, rank, getTeam()))
     {
         std::shared_ptr<Piece> leftPiece = board_.getBoardTile(file-1, rank);
-        if (leftPiece && leftPiece->getType() == PieceType::PAWN && leftPiece->getTeam() != getTeam())
+        if (board_.getLastMovedPiece() == leftPiece && leftPiece->getLastMove() == MoveType::INIT_SPECIAL)
         {
-            if (getLastMovedPiece() == leftPiece && leftPiece->getLastMove() == MoveType::INIT_SPECIAL)
-            {
-                moves_.push_back(Move({file-1, rank+dir}, pawnCoor, pPawnPos, MoveType::ENPASSANT, leftPiece));
-            }
+            moves_.push_back(Move({file-1, rank+dir}, pawnCoor, pPawnPos, MoveType::ENPASSANT, leftPiece));
         }
     }
 
     // Right En Passant
-    if (file < 7)
+    if (file < 7 && isOpponentPawnAt(position, file+1, rank, getTeam()))
     {
         std::shared_ptr<Piece> rightPiece = board_.getBoardTile(file+1, rank);
-        if (rightPiece && rightPiece->getType() == PieceType::PAWN && rightPiece->getTeam() != getTeam())
+        if (board_.getLastMovedPiece() == rightPiece && rightPiece->getLastMove() == MoveType::INIT_SPECIAL)
         {
-            if (getLastMovedPiece() == rightPiece && rightPiece->getLastMove() == MoveType::INIT_SPECIAL)
-            {
-                moves_.push_back(Move({file+1, rank+dir}, pawnCoor, pPawnPos, MoveType::ENPASSANT, rightPiece));
-            }
+            moves_.push_back(Move({file+1, rank+dir}, pawnCoor, pPawnPos, MoveType::ENPASSANT, rightPiece));
         }
     }
 }
@@ -1,10 +1,11 @@
 #include "../../../include/Logic/Pieces/Piece.hpp"
-#include "../../../include/Application/GameThread.hpp"
+#include "../../../include/Logic/Attacks.hpp"
+#include "../../../include/Logic/Board.hpp"
 
 #include <iostream>
 
 // Index-based coordinates constructor ({0, 0} == {'a', 8})
-Piece::Piece(Team team_, int file_, int rank_, PieceType type_, const string& pieceType_)
+Piece::Piece(Team team_, int file_, int rank_, PieceType type_, const std::string& pieceType_)
 : m_team(team_), 
   m_rank(rank_), 
   m_file(file_), 
@@ -14,7 +15,7 @@ Piece::Piece(Team team_, int file_, int rank_, PieceType type_, const string& pi
 }
 
 // real coordinates constructor ({8, 'a'} == {0, 0})
-Piece::Piece(Team team_, coor2dChar& coords_, PieceType type_, const string& pieceType_)
+Piece::Piece(Team team_, coor2dChar& coords_, PieceType type_, const std::string& pieceType_)
 : m_team(team_), 
   m_rank(8 - coords_.first), 
   m_file(coords_.second - 'a'), 
@@ -24,158 +25,38 @@ Piece::Piece(Team team_, coor2dChar& coords_, PieceType type_, const string& pie
 }
 
 
-void Piece::addHorizontalAndVerticalMovements(Board& board_, vector<Move>& moves) const
+void Piece::addMovementsToTargets(Board& board_, Bitboard targets_, std::vector<Move>& moves_) const
 {
-    int rank = getRank();
-    int file = getFile();
-    shared_ptr<Piece> piece = board_.getBoardTile(file, rank);
-
-    // Vertical up movement check
-    for (int i = rank - 1; i >= 0; --i)
-    {
-        if (!board_.getBoardTile(file, i))
-        {
-            moves.push_back(Move({file, i}, {file, rank}, piece, MoveType::NORMAL));
-        }
-        else if (board_.getBoardTile(file, i)->getTeam() != getTeam())
-        {
-            shared_ptr<Piece> p = board_.getBoardTile(file, i);
-            moves.push_back(Move({file, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
-
-    // Vertical down movement check
-    for (int i = rank + 1; i < 8; ++i)
-    {
-        if (!board_.getBoardTile(file, i))
-        {
-            moves.push_back(Move({file, i}, {file, rank}, piece, MoveType::NORMAL));
-        }
-        else if (board_.getBoardTile(file, i)->getTeam() != getTeam())
-        {
-            shared_ptr<Piece> p = board_.getBoardTile(file, i);
-            moves.push_back(Move({file, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
-
-    // Horizontal left movement check
-    for (int j = file - 1; j >= 0; --j)
-    {
-        if (!board_.getBoardTile(j, rank))
-        {
-            moves.push_back(Move({j, rank}, {file, rank}, piece, MoveType::NORMAL));
-        }
-        else if (board_.getBoardTile(j, rank)->getTeam() != getTeam())
-        {
-            shared_ptr<Piece> p = board_.getBoardTile(j, rank);
-            moves.push_back(Move({j, rank}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
-
-    // Horizontal right movement check
-    for (int j = file + 1; j < 8; ++j)
+    const Position& position = board_.getPosition();
+    const int file = getFile();
+    const int rank = getRank();
+    const std::shared_ptr<Piece>& piece = board_.getBoardTile(file, rank);
+
+    // Own pieces block but cannot be captured
+    targets_ &= ~position.getOccupancy(getTeam());
+    while (targets_)
     {
-        if (!board_.getBoardTile(j, rank))
-        {
-            moves.push_back(Move({j, rank}, {file, rank}, piece, MoveType::NORMAL));
-        }
-        else if (board_.getBoardTile(j, rank)->getTeam() != getTeam())
-        {
-            shared_ptr<Piece> p = board_.getBoardTile(j, rank);
-            moves.push_back(Move({j, rank}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
+        const int square = bitboard::popLsb(targets_);
+        const int targetFile = bitboard::getFile(square);
+        const int targetRank = bitboard::getRank(square);
+
+        if (position.isEmpty(square))
+            moves_.push_back(Move({targetFile, targetRank}, {file, rank}, piece, MoveType::NORMAL));
+        else
+            moves_.push_back(Move({targetFile, targetRank}, {file, rank}, piece, MoveType::CAPTURE, board_.getBoardTile(targetFile, targetRank)));
     }
 }
 
-void Piece::addDiagonalMovements(Board& board_, vector<Move>& moves_) const
+void Piece::addHorizontalAndVerticalMovements(Board& board_, std::vector<Move>& moves_) const
 {
-    int rank = getRank();
-    int file = getFile();
-    shared_ptr<Piece> piece = board_.getBoardTile(file, rank);
-
-    // Up left diagonal
-    int i = rank - 1;
-    int j = file - 1;
-    while (i >= 0 && j >= 0)
-    {
-        shared_ptr<Piece> p = board_.getBoardTile(j, i);
-        if (!p)
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::NORMAL));
-            --i; --j;
-        }
-        else if (p->getTeam() != getTeam())
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
-
-    // Up right diagonal
-    i = rank - 1; 
-    j = file + 1;
-    while (i >= 0 && j < 8)
-    {
-        shared_ptr<Piece> p = board_.getBoardTile(j, i);
-        if (!p)
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::NORMAL));
-            --i; ++j;
-        }
-        else if (p->getTeam() != getTeam())
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
-
-    // Down left diagonal
-    i = rank + 1; 
-    j = file - 1;
-    while (i < 8 && j >= 0)
-    {
-        shared_ptr<Piece> p = board_.getBoardTile(j, i);
-        if (!p)
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::NORMAL));
-            ++i; --j;
-        }
-        else if (p->getTeam() != getTeam())
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
+    const int square = bitboard::toSquare(getFile(), getRank());
+    addMovementsToTargets(board_, attacks::getRookAttacks(square, board_.getPosition().getOccupancy()), moves_);
+}
 
-    // Down right diagonal
-    i = rank + 1; 
-    j = file + 1;
-    while (i < 8 && j < 8)
-    {
-        shared_ptr<Piece> p = board_.getBoardTile(j, i);
-        if (!p)
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::NORMAL));
-            ++i; ++j;
-        }
-        else if (p->getTeam() != getTeam())
-        {
-            moves_.push_back(Move({j, i}, {file, rank}, piece, MoveType::CAPTURE, p));
-            break;
-        }
-        else break;
-    }
+void Piece::addDiagonalMovements(Board& board_, std::vector<Move>& moves_) const
+{
+    const int square = bitboard::toSquare(getFile(), getRank());
+    addMovementsToTargets(board_, attacks::getBishopAttacks(square, board_.getPosition().getOccupancy()), moves_);
 }
 
 std::ostream& operator<<(std::ostream& os_, const PieceType& pieceType_) 
@@ -1,4 +1,6 @@
 #include "../../../include/Logic/Pieces/Queen.hpp"
+#include "../../../include/Logic/Attacks.hpp"
+#include "../../../include/Logic/Board.hpp"
 
 #include <vector>
 
@@ -18,7 +20,7 @@ std::vector<Move> Queen::calcPossibleMoves(Board& board_) const
 {
     // Combine horizontal, vertical and diagonal movements
     std::vector<Move> moves;
-    addHorizontalAndVerticalMovements(board_, moves);
-    addDiagonalMovements(board_, moves);
+    const int square = bitboard::toSquare(getFile(), getRank());
+    addMovementsToTargets(board_, attacks::getQueenAttacks(square, board_.getPosition().getOccupancy()), moves);
     return moves;
 }
@@ -0,0 +1,219 @@
+#include "../../include/Logic/Position.hpp"
+#include "../../include/Logic/Attacks.hpp"
+
+#include <cassert>
+#include <cctype>
+
+namespace
+{
+    char pieceTypeToLetter(PieceType type_)
+    {
+        switch (type_)
+        {
+            case PieceType::PAWN: return 'P';
+            case PieceType::ROOK: return 'R';
+            case PieceType::KNIGHT: return 'N';
+            case PieceType::BISHOP: return 'B';
+            case PieceType::KING: return 'K';
+            case PieceType::QUEEN: return 'Q';
+        }
+        return '?';
+    }
+
+    // Castling rights kept when a piece moves from or to a square, i.e. the
+    // rights lost when a king or rook leaves its initial square or a rook is
+    // captured on it
+    uint8_t castlingRightsKeptBy(int square_)
+    {
+        switch (square_)
+        {
+            case bitboard::toSquare(0, 7): return static_cast<uint8_t>(~g_WHITE_QUEENSIDE);
+            case bitboard::toSquare(4, 7): return static_cast<uint8_t>(~(g_WHITE_KINGSIDE | g_WHITE_QUEENSIDE));
+            case bitboard::toSquare(7, 7): return static_cast<uint8_t>(~g_WHITE_KINGSIDE);
+            case bitboard::toSquare(0, 0): return static_cast<uint8_t>(~g_BLACK_QUEENSIDE);
+            case bitboard::toSquare(4, 0): return static_cast<uint8_t>(~(g_BLACK_KINGSIDE | g_BLACK_QUEENSIDE));
+            case bitboard::toSquare(7, 0): return static_cast<uint8_t>(~g_BLACK_KINGSIDE);
+            default: return static_cast<uint8_t>(~g_NO_CASTLING);
+        }
+    }
+}
+
+void Position::clear()
+{
+    for (auto& teamPieces: m_pieces)
+        for (auto& pieces: teamPieces) pieces = bitboard::g_EMPTY;
+
+    for (auto& occupancy: m_occupancy) occupancy = bitboard::g_EMPTY;
+    for (auto& square: m_mailbox) square = g_EMPTY_SQUARE;
+    m_turn = Team::WHITE;
+    m_castlingRights = g_NO_CASTLING;
+    m_enPassantSquare = bitboard::g_NO_SQUARE;
+    m_hash = computeHash();
+}
+
+void Position::setPiece(int square_, Team team_, PieceType type_)
+{
+    assert(square_ >= 0 && square_ < bitboard::g_NUMBER_OF_SQUARES);
+    removePiece(square_);
+
+    const Bitboard mask = bitboard::squareMask(square_);
+    m_pieces[teamIndex(team_)][pieceTypeIndex(type_)] |= mask;
+    m_occupancy[teamIndex(team_)] |= mask;
+    m_mailbox[square_] = static_cast<int8_t>(teamIndex(team_) * g_NUMBER_OF_PIECE_TYPES + pieceTypeIndex(type_));
+    m_hash ^= zobrist::getPieceKey(teamIndex(team_), pieceTypeIndex(type_), square_);
+}
+
+void Position::removePiece(int square_)
+{
+    assert(square_ >= 0 && square_ < bitboard::g_NUMBER_OF_SQUARES);
+    if (isEmpty(square_)) return;
+
+    const Bitboard mask = bitboard::squareMask(square_);
+    const int team = m_mailbox[square_] / g_NUMBER_OF_PIECE_TYPES;
+    const int type = m_mailbox[square_] % g_NUMBER_OF_PIECE_TYPES;
+    m_pieces[team][type] &= ~mask;
+    m_occupancy[team] &= ~mask;
+    m_mailbox[square_] = g_EMPTY_SQUARE;
+    m_hash ^= zobrist::getPieceKey(team, type, square_);
+}
+
+void Position::makeMove(CompactMove move_)
+{
+    const int from = move_.getFrom();
+    const int to = move_.getTo();
+    const Team team = getTeamAt(from);
+    const PieceType type = getTypeAt(from);
+
+    int enPassantSquare = bitboard::g_NO_SQUARE;
+    switch (move_.getMoveType())
+    {
+        case MoveType::ENPASSANT:
+            // The taken pawn stands next to the capturing one
+            removePiece(bitboard::toSquare(bitboard::getFile(to), bitboard::getRank(from)));
+            break;
+        case MoveType::CASTLE_KINGSIDE:
+            removePiece(to + 1);
+            setPiece(to - 1, team, PieceType::ROOK);
+            break;
+        case MoveType::CASTLE_QUEENSIDE:
+            removePiece(to - 2);
+            setPiece(to + 1, team, PieceType::ROOK);
+            break;
+        case MoveType::INIT_SPECIAL:
+        {
+            const int skippedSquare = (from + to) / 2;
+            if (canCaptureEnPassant(skippedSquare, opponentOf(team))) enPassantSquare = skippedSquare;
+            break;
+        }
+        default:
+            break;
+    }
+
+    removePiece(from);
+    setPiece(to, team, (move_.getMoveType() == MoveType::NEWPIECE)? move_.getPromotion(): type);
+
+    setEnPassantSquare(enPassantSquare);
+    setCastlingRights(m_castlingRights & castlingRightsKeptBy(from) & castlingRightsKeptBy(to));
+    switchTurn();
+    assert(m_hash == computeHash());
+}
+
+void Position::switchTurn()
+{
+    m_turn = opponentOf(m_turn);
+    m_hash ^= zobrist::getBlackToMoveKey();
+}
+
+void Position::setCastlingRights(uint8_t castlingRights_)
+{
+    assert(castlingRights_ < zobrist::g_NUMBER_OF_CASTLING_RIGHTS);
+    m_hash ^= zobrist::getCastlingRightsKey(m_castlingRights) ^ zobrist::getCastlingRightsKey(castlingRights_);
+    m_castlingRights = castlingRights_;
+}
+
+void Position::setEnPassantSquare(int square_)
+{
+    m_hash ^= zobrist::getEnPassantKey(m_enPassantSquare) ^ zobrist::getEnPassantKey(square_);
+    m_enPassantSquare = square_;
+}
+
+bool Position::canCaptureEnPassant(int square_, Team byTeam_) const
+{
+    // The capturing pawns are those a pawn of the other team on square_ would attack
+    return attacks::getPawnAttacks(teamIndex(opponentOf(byTeam_)), square_) & getPieces(byTeam_, PieceType::PAWN);
+}
+
+uint64_t Position::computeHash() const
+{
+    uint64_t hash = 0;
+    for (int square = 0; square < bitboard::g_NUMBER_OF_SQUARES; ++square)
+    {
+        if (isEmpty(square)) continue;
+        hash ^= zobrist::getPieceKey(teamIndex(getTeamAt(square)), pieceTypeIndex(getTypeAt(square)), square);
+    }
+
+    if (m_turn == Team::BLACK) hash ^= zobrist::getBlackToMoveKey();
+    hash ^= zobrist::getCastlingRightsKey(m_castlingRights);
+    hash ^= zobrist::getEnPassantKey(m_enPassantSquare);
+    return hash;
+}
+
+Team Position::getTeamAt(int square_) const
+{
+    assert(!isEmpty(square_));
+    return static_cast<Team>(m_mailbox[square_] / g_NUMBER_OF_PIECE_TYPES);
+}
+
+PieceType Position::getTypeAt(int square_) const
+{
+    assert(!isEmpty(square_));
+    return static_cast<PieceType>(m_mailbox[square_] % g_NUMBER_OF_PIECE_TYPES);
+}
+
+int Position::getKingSquare(Team team_) const
+{
+    const Bitboard king = getPieces(team_, PieceType::KING);
+    return king? bitboard::lsb(king): bitboard::g_NO_SQUARE;
+}
+
+bool Position::isSquareAttacked(int square_, Team byTeam_, Bitboard occupancy_) const
+{
+    // Attacks are symmetric: look outward from the square with each piece's
+    // pattern and see whether it lands on an attacker of that kind. For pawns
+    // this means using the pattern of a pawn of the defending team.
+    if (attacks::getPawnAttacks(teamIndex(opponentOf(byTeam_)), square_) & getPieces(byTeam_, PieceType::PAWN))
+        return true;
+    if (attacks::getKnightAttacks(square_) & getPieces(byTeam_, PieceType::KNIGHT))
+        return true;
+    if (attacks::getKingAttacks(square_) & getPieces(byTeam_, PieceType::KING))
+        return true;
+
+    const Bitboard queens = getPieces(byTeam_, PieceType::QUEEN);
+    if (attacks::getRookAttacks(square_, occupancy_) & (getPieces(byTeam_, PieceType::ROOK) | queens))
+        return true;
+    return attacks::getBishopAttacks(square_, occupancy_) & (getPieces(byTeam_, PieceType::BISHOP) | queens);
+}
+
+void Position::print(std::ostream& os_) const
+{
+    os_ << "==Current state of Board==\n";
+    for (int rank = 0; rank < 8; ++rank)
+    {
+        os_ << 8 - rank << ' ';
+        for (int file = 0; file < 8; ++file)
+        {
+            const int square = bitboard::toSquare(file, rank);
+            if (isEmpty(square))
+            {
+                os_ << ". ";
+                continue;
+            }
+
+            char pieceChar = pieceTypeToLetter(getTypeAt(square));
+            if (getTeamAt(square) == Team::BLACK) pieceChar = std::tolower(pieceChar);
+            os_ << pieceChar << ' ';
+        }
+        os_ << '\n';
+    }
+    os_ << "  a b c d e f g h\n";
+}
@@ -0,0 +1,197 @@
+#include "../../include/Logic/SAN.hpp"
+#include "../../include/Logic/MoveGenerator.hpp"
+
+#include <optional>
+
+namespace
+{
+    constexpr int g_ANY = -1; // File or rank the token leaves open
+
+    std::optional<PieceType> pieceFromLetter(char letter_)
+    {
+        switch (letter_)
+        {
+            case 'N': return PieceType::KNIGHT;
+            case 'B': return PieceType::BISHOP;
+            case 'R': return PieceType::ROOK;
+            case 'Q': return PieceType::QUEEN;
+            case 'K': return PieceType::KING;
+            default: return std::nullopt;
+        }
+    }
+
+    char letterFromPiece(PieceType piece_)
+    {
+        switch (piece_)
+        {
+            case PieceType::KNIGHT: return 'N';
+            case PieceType::BISHOP: return 'B';
+            case PieceType::ROOK: return 'R';
+            case PieceType::QUEEN: return 'Q';
+            case PieceType::KING: return 'K';
+            default: return '\0';
+        }
+    }
+
+    bool isFile(char c_) { return c_ >= 'a' && c_ <= 'h'; }
+    bool isRank(char c_) { return c_ >= '1' && c_ <= '8'; }
+    int toGridRank(char rank_) { return '8' - rank_; }
+    char fileLetter(int square_) { return static_cast<char>('a' + bitboard::getFile(square_)); }
+    char rankDigit(int square_) { return static_cast<char>('8' - bitboard::getRank(square_)); }
+
+    std::string_view stripSuffixes(std::string_view move_)
+    {
+        while (!move_.empty() && std::string_view("+#!?").find(move_.back()) != std::string_view::npos)
+            move_.remove_suffix(1);
+        return move_;
+    }
+
+    std::optional<MoveType> castlingType(std::string_view move_)
+    {
+        if (move_ == "O-O" || move_ == "0-0") return MoveType::CASTLE_KINGSIDE;
+        if (move_ == "O-O-O" || move_ == "0-0-0") return MoveType::CASTLE_QUEENSIDE;
+        return std::nullopt;
+    }
+
+    // The only match, or a null move
+    template <typename Predicate>
+    CompactMove findUniqueMove(const Position& position_, Predicate isMatch_)
+    {
+        MoveList moves;
+        MoveGenerator(position_).generateLegalMoves(moves);
+
+        CompactMove match;
+        for (auto move: moves)
+        {
+            if (!isMatch_(move)) continue;
+            if (!match.isNull()) return CompactMove(); // Ambiguous
+            match = move;
+        }
+        return match;
+    }
+}
+
+CompactMove san::parseMove(const Position& position_, std::string_view move_)
+{
+    move_ = stripSuffixes(move_);
+
+    if (const auto castling = castlingType(move_))
+    {
+        return findUniqueMove(position_, [type = *castling](CompactMove candidate_) { return candidate_.getMoveType() == type; });
+    }
+
+    // Piece letter, then optional origin file and rank, optional capture,
+    // target square and, for pawns, optional promotion
+    PieceType piece = PieceType::PAWN;
+    if (!move_.empty())
+    {
+        if (const auto letter = pieceFromLetter(move_.front()))
+        {
+            piece = *letter;
+            move_.remove_prefix(1);
+        }
+    }
+
+    std::optional<PieceType> promotion;
+    if (piece == PieceType::PAWN && !move_.empty() && !isRank(move_.back()))
+    {
+        promotion = pieceFromLetter(move_.back());
+        if (!promotion || promotion == PieceType::KING) return CompactMove();
+        move_.remove_suffix(1);
+        if (!move_.empty() && move_.back() == '=') move_.remove_suffix(1);
+    }
+
+    if (move_.size() < 2 || !isFile(move_[move_.size() - 2]) || !isRank(move_.back())) return CompactMove();
+    const int target = bitboard::toSquare(move_[move_.size() - 2] - 'a', toGridRank(move_.back()));
+    move_.remove_suffix(2);
+
+    if (!move_.empty() && (move_.back() == 'x' || move_.back() == '-')) move_.remove_suffix(1);
+
+    int originFile = g_ANY;
+    int originRank = g_ANY;
+    if (!move_.empty() && isFile(move_.front()))
+    {
+        originFile = move_.front() - 'a';
+        move_.remove_prefix(1);
+    }
+    if (!move_.empty() && isRank(move_.front()))
+    {
+        originRank = toGridRank(move_.front());
+        move_.remove_prefix(1);
+    }
+    if (!move_.empty()) return CompactMove();
+
+    return findUniqueMove(position_, [&](CompactMove candidate_)
+    {
+        if (candidate_.getTo() != target || position_.getTypeAt(candidate_.getFrom()) != piece) return false;
+        if (candidate_.getMoveType() == MoveType::CASTLE_KINGSIDE || candidate_.getMoveType() == MoveType::CASTLE_QUEENSIDE) return false;
+        if (originFile != g_ANY && bitboard::getFile(candidate_.getFrom()) != originFile) return false;
+        if (originRank != g_ANY && bitboard::getRank(candidate_.getFrom()) != originRank) return false;
+
+        const bool isPromotion = candidate_.getMoveType() == MoveType::NEWPIECE;
+        if (isPromotion != promotion.has_value()) return false;
+        return !isPromotion || candidate_.getPromotion() == *promotion;
+    });
+}
+
+std::string san::toSAN(const Position& position_, CompactMove move_)
+{
+    MoveList moves;
+    MoveGenerator(position_).generateLegalMoves(moves);
+
+    const int from = move_.getFrom();
+    const int to = move_.getTo();
+    const MoveType type = move_.getMoveType();
+
+    std::string text;
+    if (type == MoveType::CASTLE_KINGSIDE) text = "O-O";
+    else if (type == MoveType::CASTLE_QUEENSIDE) text = "O-O-O";
+    else
+    {
+        const PieceType piece = position_.getTypeAt(from);
+        const bool isCapture = !position_.isEmpty(to) || type == MoveType::ENPASSANT;
+
+        if (piece == PieceType::PAWN)
+        {
+            if (isCapture) text += fileLetter(from);
+        }
+        else
+        {
+            text += letterFromPiece(piece);
+
+            // The file if it tells the pieces apart, else the rank, else both
+            bool isAmbiguous = false;
+            bool isFileShared = false;
+            bool isRankShared = false;
+            for (auto other: moves)
+            {
+                if (other.getTo() != to || other.getFrom() == from || position_.getTypeAt(other.getFrom()) != piece) continue;
+                isAmbiguous = true;
+                isFileShared = isFileShared || bitboard::getFile(other.getFrom()) == bitboard::getFile(from);
+                isRankShared = isRankShared || bitboard::getRank(other.getFrom()) == bitboard::getRank(from);
+            }
+            if (isAmbiguous && (!isFileShared || isRankShared)) text += fileLetter(from);
+            if (isAmbiguous && isFileShared) text += rankDigit(from);
+        }
+
+        if (isCapture) text += 'x';
+        text += fileLetter(to);
+        text += rankDigit(to);
+        if (type == MoveType::NEWPIECE)
+        {
+            text += '=';
+            text += letterFromPiece(move_.getPromotion());
+        }
+    }
+
+    Position after = position_;
+    after.makeMove(move_);
+    const MoveGenerator generator(after);
+    if (generator.isInCheck())
+    {
+        MoveList replies;
+        generator.generateLegalMoves(replies);
+        text += replies.empty()? '#': '+';
+    }
+    return text;
+}
@@ -0,0 +1,42 @@
+#include "../../include/Logic/Zobrist.hpp"
+
+namespace
+{
+    // SplitMix64, small enough to be evaluated by the compiler
+    constexpr uint64_t nextRandom(uint64_t& state_)
+    {
+        uint64_t value = (state_ += 0x9E3779B97F4A7C15ULL);
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    constexpr zobrist::Keys generateKeys()
+    {
+        zobrist::Keys keys{};
+        uint64_t state = 0x5A0B8157C0FFEE11ULL;
+
+        for (auto& teamKeys: keys.m_pieces)
+            for (auto& pieceKeys: teamKeys)
+                for (auto& key: pieceKeys) key = nextRandom(state);
+
+        keys.m_blackToMove = nextRandom(state);
+
+        // No rights at all leaves the hash untouched
+        keys.m_castlingRights[0] = 0;
+        for (int rights = 1; rights < zobrist::g_NUMBER_OF_CASTLING_RIGHTS; ++rights)
+            keys.m_castlingRights[rights] = nextRandom(state);
+
+        for (auto& key: keys.m_enPassantFiles) key = nextRandom(state);
+        return keys;
+    }
+}
+
+// Forces the generation to happen at compile time
+static_assert(generateKeys().m_blackToMove != 0);
+
+namespace zobrist
+{
+    // Constant initialized, so usable by positions built during static initialization
+    extern const Keys g_keys = generateKeys();
+}
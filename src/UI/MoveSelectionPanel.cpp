@@ -84,13 +84,16 @@ void MoveSelectionPanel::drawMoveSelectionPanel(MoveTree::Iterator& it_)
     bool showNumber = moveListSize % 2 != 0;
     vector<string> variations;
 
-    for (size_t i = 0; i < it_.get()->childNumber; ++i)
+    MoveTree::Iterator child = it_;
+    for (int i = 0; i < it_.getChildCount(); ++i)
     {
+        child.goToChild(i);
         variations.push_back(
             parseMove(
-                *(it_.get()->m_children.at(i)->m_move), moveNumber, showNumber, true
+                child, moveNumber, showNumber, true
             )
         );
+        child.goToParent();
     }
     // Set the number of variations locally
     m_numberOfVariations = variations.size();
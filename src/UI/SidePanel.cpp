@@ -9,16 +9,6 @@ namespace
         return absolutePosition_.first + moveBox_.getScaledWidth() > ui::g_PANEL_SIZE - ui::g_BORDER_SIZE;
     }
 
-    void updateRowInAllRemainingMoves(std::vector<MoveInfo>& moveTreeInfo_, size_t idx_) 
-    {
-        // -1 here because we already increased the row of the current 
-        // moveInfo structure in handleOutOfBounds function.
-        int currRow = moveTreeInfo_[idx_].m_row - 1;
-        while (moveTreeInfo_[idx_].m_row == currRow) ++idx_;
-
-        for (; idx_ < moveTreeInfo_.size(); ++idx_) ++moveTreeInfo_[idx_].m_row;
-    }
-
     void handleMoveBoxHovered(MoveBox& moveBox_, const coor2d& mousePos_)
     {
         moveBox_.setIsHovered(moveBox_.isHowered(mousePos_));
@@ -184,7 +174,7 @@ void SidePanel::drawSquareBracket(coor2d& nextPos_, int offset_, bool open_) con
     nextPos_.first -= offset_;
 }
 
-void SidePanel::drawMovePrefix(const std::string& prefixLetter_, coor2d& position_)
+void SidePanel::placeMovePrefix(PlacedMove& placedMove_, const std::string& prefixLetter_, coor2d& position_)
 {
     auto font = RessourceManager::getFont("Arial.ttf");
     auto text = createMovePrefixText(prefixLetter_, *font);
@@ -194,47 +184,41 @@ void SidePanel::drawMovePrefix(const std::string& prefixLetter_, coor2d& positio
     text.setPosition(ui::g_WINDOW_SIZE + position_.first + positionalShift,
                       ui::g_MENUBAR_HEIGHT + position_.second);
 
-    m_window.draw(rect);
-    m_window.draw(text);
-
     // Update the next position to draw
     position_.first += rect.getGlobalBounds().width;
+    placedMove_.m_prefix = std::make_pair(text, rect);
 }
 
-void SidePanel::drawMove(
-    std::vector<MoveInfo>& moveTreeInfo_, 
-    size_t idx_,
-    const coor2d& mousePos_, 
-    bool isActualCurrentMove_)
+void SidePanel::layoutMove(MoveInfo move_)
 {
-    MoveInfo& move = moveTreeInfo_[idx_];
+    // Moves after a wrapped line are pushed down as they come, which keeps
+    // the layout linear in the number of moves
+    move_.m_row += m_rowShift;
 
     coor2d absolutePosition;
     // We first initialize the moveBox's top left coordinates based off
     // The MoveInfo's indentation level and row.
-    initializeMoveBoxCoodinates(move, absolutePosition);
+    initializeMoveBoxCoodinates(move_, absolutePosition);
+
+    PlacedMove placedMove;
+    placedMove.m_node = move_.m_node;
 
     // For subvariations we must draw the letter and number prefix.
-    if (move.m_letterPrefix.has_value())
+    if (move_.m_letterPrefix.has_value())
     {
-        drawMovePrefix(move.m_letterPrefix.value(), absolutePosition);
+        placeMovePrefix(placedMove, move_.m_letterPrefix.value(), absolutePosition);
     }
 
     // Construct the Move Box
-    MoveBox moveBox(absolutePosition, move.m_content); // Make the text box
+    MoveBox moveBox(absolutePosition, move_.m_content); // Make the text box
     moveBox.handleText(); // Create the Text, and pass the font resource
     moveBox.handleRectangle(); // Create the Rectangle to display.
 
     if (moveBoxIsOutOfBounds(absolutePosition, moveBox))
     {
-        handleMoveBoxOutOfBounds(absolutePosition, moveBox, move);
-        updateRowInAllRemainingMoves(moveTreeInfo_, idx_);
+        handleMoveBoxOutOfBounds(absolutePosition, moveBox, move_);
+        ++m_rowShift;
     }
-    handleMoveBoxHovered(moveBox, mousePos_);
-    handleMoveBoxIsCurrentMove(moveBox, isActualCurrentMove_);
-
-    m_window.draw(moveBox.getRectangle());
-    m_window.draw(moveBox.getTextsf());
 
     coor2d realDimensionsOfCurrentMoveBox = {
         static_cast<int>(moveBox.getScaledWidth()), 
@@ -243,19 +227,44 @@ void SidePanel::drawMove(
     // Update the next position to draw
     m_nextPos.first = absolutePosition.first + realDimensionsOfCurrentMoveBox.first;
     m_nextPos.second = absolutePosition.second;
-}
 
+    placedMove.m_moveBox = moveBox;
+    m_placedMoves.push_back(std::move(placedMove));
+}
 
-void SidePanel::drawMoves(std::vector<MoveInfo> moveTreeInfo_, const coor2d& mousePos_)
+void SidePanel::drawMoves(MoveTreeDisplayHandler& moveTreeDisplayHandler_, const coor2d& mousePos_)
 {
-    // Reset the initial drawing position
-    m_nextPos = {ui::g_BORDER_SIZE + 10, 0};
+    // The boxes are only laid out when the moves to display changed, and
+    // only from the first new move unless the display handler started over
+    const std::vector<MoveInfo>& moveInfos = moveTreeDisplayHandler_.generateMoveInfo();
+    if (moveTreeDisplayHandler_.getRevision() != m_layoutRevision)
+    {
+        if (moveTreeDisplayHandler_.getRebuildCount() != m_layoutRebuildCount)
+        {
+            m_placedMoves.clear();
+            m_nextPos = {ui::g_BORDER_SIZE + 10, 0};
+            m_previousRow = 0;
+            m_rowShift = 0;
+            m_layoutRebuildCount = moveTreeDisplayHandler_.getRebuildCount();
+        }
+        for (size_t idx = m_placedMoves.size(); idx < moveInfos.size(); ++idx) layoutMove(moveInfos[idx]);
+        m_layoutRevision = moveTreeDisplayHandler_.getRevision();
+    }
 
-    size_t idx = 0;
-    for (const MoveInfo& moveInfo : moveTreeInfo_)
+    const NodeIndex currentNode = m_moveTreeManager.getIterator().getIndex();
+    for (PlacedMove& placedMove : m_placedMoves)
     {
-        const bool isActualCurrentMove = moveInfo.m_movePtr == m_moveTreeManager.getIterator()->m_move.get();
-        drawMove(moveTreeInfo_, idx, mousePos_, isActualCurrentMove);
-        ++idx;
+        if (placedMove.m_prefix.has_value())
+        {
+            m_window.draw(placedMove.m_prefix->second);
+            m_window.draw(placedMove.m_prefix->first);
+        }
+
+        MoveBox& moveBox = placedMove.m_moveBox;
+        handleMoveBoxHovered(moveBox, mousePos_);
+        handleMoveBoxIsCurrentMove(moveBox, placedMove.m_node == currentNode);
+
+        m_window.draw(moveBox.getRectangle());
+        m_window.draw(moveBox.getTextsf());
     }
 }
@@ -3,8 +3,53 @@
 #include "../Ressources/Shader.cpp"
 #include "../../include/UI/SidePanel.hpp"
 
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
 class MoveTreeManager;
 
+namespace
+{
+    // Promotions are listed once per piece, only the queen one is displayed
+    bool isMoveOfPiece(CompactMove move_, const std::shared_ptr<Piece>& pPiece_)
+    {
+        if (move_.getMoveType() == MoveType::NEWPIECE && move_.getPromotion() != PieceType::QUEEN) return false;
+        return move_.getFrom() == bitboard::toSquare(pPiece_->getFile(), pPiece_->getRank());
+    }
+
+    constexpr size_t g_DISPLAYED_VARIATION_LENGTH = 8;
+
+    // Long enough for a deep search, short enough not to keep a core busy
+    // on a position left on screen
+    constexpr std::chrono::seconds g_ANALYSIS_TIME_LIMIT{20};
+
+    // "Depth 12  +0.35  e2e4 e7e5 ...", the score being from white's point of view
+    std::string formatAnalysis(const engine::SearchResult& result_, Team turn_)
+    {
+        std::ostringstream os;
+        os << "Depth " << result_.m_depth << "  ";
+
+        const int score = (turn_ == Team::WHITE)? result_.m_score: -result_.m_score;
+        if (engine::isMateScore(score))
+        {
+            const int movesToMate = (engine::g_MATE_SCORE - std::abs(score) + 1) / 2;
+            os << '#' << ((score > 0)? movesToMate: -movesToMate);
+        }
+        else
+        {
+            os << std::showpos << std::fixed << std::setprecision(2) << score / 100.0 << std::noshowpos;
+        }
+
+        os << ' ';
+        for (size_t i = 0; i < result_.m_principalVariation.size() && i < g_DISPLAYED_VARIATION_LENGTH; ++i)
+        {
+            os << ' ' << result_.m_principalVariation[i];
+        }
+        return os.str();
+    }
+}
+
 namespace ui {
     UIManager::UIManager(
     Board& board_, 
@@ -37,9 +82,12 @@ namespace ui {
     {
         // Note that order of function calls in this function is important
         // otherwise drawing is affected negatively.
+        updateAnalysis(dragState_);
+
         drawMenuBar();
         drawBoardSquares();
         drawSidePanel();
+        drawAnalysis();
 
         if (m_board.isKingChecked()) drawKingCheckCircle();
 
@@ -125,9 +173,53 @@ namespace ui {
         // Draw the content on the panels
         Vector2i position = sf::Mouse::getPosition(m_window);
         coor2d mousePos = {position.x, position.y};
-        m_sidePanel.drawMoves(
-            m_moveTreeManager.getMoveTreeDisplayHandler().generateMoveInfo(),
-            mousePos);
+        m_sidePanel.drawMoves(m_moveTreeManager.getMoveTreeDisplayHandler(), mousePos);
+    }
+
+    void UIManager::toggleAnalysis()
+    {
+        m_isAnalysisEnabled = !m_isAnalysisEnabled;
+        if (m_isAnalysisEnabled) return;
+
+        m_analysisWorker.cancel();
+        m_analysedHash = 0;
+        m_analysis = engine::AnalysisUpdate();
+    }
+
+    void UIManager::updateAnalysis(const DragState& dragState_)
+    {
+        if (!m_isAnalysisEnabled) return;
+
+        // Moves, navigation in the move tree and resets all change the position,
+        // which restarts the analysis. A dragged piece is off the board until
+        // dropped, so that position is not worth analysing.
+        if (!dragState_.pieceIsMoving && m_board.hash() != m_analysedHash)
+        {
+            m_analysedHash = m_board.hash();
+            m_analysis = engine::AnalysisUpdate();
+            engine::SearchLimits limits;
+            limits.m_time = g_ANALYSIS_TIME_LIMIT;
+            m_analysisWorker.analyse(m_board.getPosition(), limits, m_moveTreeManager.getPositionHistory());
+        }
+
+        // Never waits: only the iterations completed since the last frame are read
+        engine::AnalysisUpdate update;
+        while (m_analysisWorker.pollUpdate(update)) m_analysis = std::move(update);
+    }
+
+    void UIManager::drawAnalysis()
+    {
+        if (m_analysis.m_result.m_depth == 0 || m_analysis.m_positionHash != m_board.hash()) return;
+
+        auto font = RessourceManager::getFont("Arial.ttf");
+        Text text;
+        SFDrawUtil::drawTextSf(
+            text, formatAnalysis(m_analysis.m_result, m_board.getTurn()),
+            *font, 18, Text::Regular, {240, 248, 255});
+        text.setPosition(
+            g_WINDOW_SIZE + 2*g_BORDER_SIZE,
+            g_MENUBAR_HEIGHT + g_MAIN_PANEL_HEIGHT - g_BORDER_SIZE + (g_SOUTH_PANEL_HEIGHT - 18) / 2 - 2);
+        m_window.draw(text);
     }
 
     void UIManager::drawGrayCover()
@@ -144,11 +236,11 @@ namespace ui {
     void UIManager::highlightHoveredSquare(
         const shared_ptr<Piece>& pSelectedPiece_, 
         const coor2d& mousePos_,
-        const vector<Move>& possibleMoves_)
+        const MoveList& possibleMoves_)
     {
         const Color colours[2] = {{173, 176, 134}, {100, 111, 64}};
 
-        for (auto& move: possibleMoves_)
+        for (auto move: possibleMoves_)
         {
             auto [filePiece, rankPiece] = move.getTarget();
             if (m_board.isFlipped()) 
@@ -156,7 +248,7 @@ namespace ui {
                 rankPiece = 7 - rankPiece; 
                 filePiece = 7 - filePiece;
             }
-            if (move.getSelectedPiece() != pSelectedPiece_) continue;
+            if (!isMoveOfPiece(move, pSelectedPiece_)) continue;
             int fileMouse = getFile(mousePos_);
             int rankMouse = getRank(mousePos_);
 
@@ -177,13 +269,13 @@ namespace ui {
 
     void UIManager::drawCaptureCircles(
         const shared_ptr<Piece>& pSelectedPiece_,
-        const vector<Move>& possibleMoves_)
+        const MoveList& possibleMoves_)
     {
-        for (auto& move: possibleMoves_)
+        for (auto move: possibleMoves_)
         {
             auto [file, rank] = move.getTarget();
 
-            if (move.getSelectedPiece() != pSelectedPiece_) continue;
+            if (!isMoveOfPiece(move, pSelectedPiece_)) continue;
             bool isEmpty = m_board.getBoardTile(file, rank).get() == nullptr;
             auto texture = RessourceManager::getTexture(isEmpty? "circle.png": "empty_circle.png");
 
@@ -201,7 +293,7 @@ namespace ui {
 
     void UIManager::highlightLastMove()
     {
-        shared_ptr<Move> move = m_moveTreeManager.getIterator()->m_move;
+        shared_ptr<Move> move = m_moveTreeManager.getIterator().getMove();
         if (!move) return;
         
         RectangleShape squareBefore = ui::createSquare();
@@ -0,0 +1,205 @@
+#include "../../include/Utilities/EnginePool.hpp"
+#include "../../include/Logic/MoveTree.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <deque>
+#include <iomanip>
+#include <poll.h>
+#include <sstream>
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    // "[%eval 0.35]" or "[%eval #-3]", the usual PGN comment for evaluations
+    std::string toEvalComment(const MoveEvaluation& evaluation_)
+    {
+        std::ostringstream os;
+        os << "[%eval ";
+        if (evaluation_.m_mate) os << '#' << *evaluation_.m_mate;
+        else os << std::fixed << std::setprecision(2) << evaluation_.m_centipawns / 100.0;
+        os << ']';
+        return os.str();
+    }
+
+    // Replaces the evaluation of an earlier run, keeps the rest of the comment
+    void setEvalComment(std::string& comment_, const MoveEvaluation& evaluation_)
+    {
+        const std::string eval = toEvalComment(evaluation_);
+        const size_t start = comment_.find("[%eval ");
+        const size_t end = (start == std::string::npos)? std::string::npos: comment_.find(']', start);
+        if (end != std::string::npos)
+        {
+            comment_.replace(start, end - start + 1, eval);
+            return;
+        }
+        if (!comment_.empty()) comment_ += ' ';
+        comment_ += eval;
+    }
+
+    bool isWhiteToMove(const std::string& fen_)
+    {
+        const size_t turn = fen_.find(' ');
+        return turn == std::string::npos || fen_.compare(turn, 3, " b ") != 0;
+    }
+}
+
+EnginePool::EnginePool(std::string command_, std::vector<std::string> arguments_, unsigned engineCount_):
+    m_command(std::move(command_)),
+    m_arguments(std::move(arguments_)),
+    m_slots(std::max(engineCount_, 1u))
+{
+}
+
+EnginePool::~EnginePool() = default;
+
+std::vector<EnginePool::JobResult> EnginePool::run(const std::vector<Job>& jobs_, const UCIGoLimits& limits_)
+{
+    const auto start = Clock::now();
+    m_stats = Stats();
+
+    std::vector<JobResult> results(jobs_.size());
+    std::vector<int> attempts(jobs_.size(), 0);
+    std::deque<int> pendingJobs;
+    for (size_t i = 0; i < jobs_.size(); ++i) pendingJobs.push_back(static_cast<int>(i));
+    size_t remainingJobs = jobs_.size();
+
+    // A failed job is retried first, by the next idle engine
+    auto failJob = [&](int job_)
+    {
+        if (attempts[job_] < g_MAX_ATTEMPTS) pendingJobs.push_front(job_);
+        else --remainingJobs;
+    };
+
+    while (remainingJobs > 0)
+    {
+        for (auto& slot: m_slots)
+        {
+            if (slot.m_job >= 0 || pendingJobs.empty()) continue;
+
+            const int job = pendingJobs.front();
+            pendingJobs.pop_front();
+            ++attempts[job];
+            if ((!slot.m_pEngine || !slot.m_pEngine->isRunning()) && !startEngine(slot))
+            {
+                failJob(job);
+                continue;
+            }
+
+            const Job& position = jobs_[job];
+            if (position.m_fen.empty()) slot.m_pEngine->setStartPosition(position.m_moves);
+            else slot.m_pEngine->setPosition(position.m_fen, position.m_moves);
+
+            slot.m_job = job;
+            slot.m_jobStart = Clock::now();
+            slot.m_lastInfo = UCIInfo();
+            Slot* pSlot = &slot;
+            slot.m_pEngine->go(limits_, [pSlot](const UCIInfo& info_)
+            {
+                if (info_.m_multiPV == 1 && (info_.m_centipawns || info_.m_mate)) pSlot->m_lastInfo = info_;
+            });
+        }
+
+        // Sleep until an engine writes or the oldest job times out
+        std::vector<pollfd> outputs;
+        int timeout = -1;
+        for (const auto& slot: m_slots)
+        {
+            if (slot.m_job < 0 || !slot.m_pEngine->isRunning()) continue;
+            outputs.push_back({slot.m_pEngine->getOutputFd(), POLLIN, 0});
+            if (m_jobTimeout.count() == 0) continue;
+
+            const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(slot.m_jobStart + m_jobTimeout - Clock::now());
+            const int leftMilliseconds = static_cast<int>(std::max<long long>(left.count(), 0));
+            timeout = (timeout < 0)? leftMilliseconds: std::min(timeout, leftMilliseconds);
+        }
+        if (!outputs.empty() && ::poll(outputs.data(), outputs.size(), timeout) < 0 && errno != EINTR) break;
+
+        for (auto& slot: m_slots)
+        {
+            if (slot.m_job < 0) continue;
+
+            const auto bestMove = slot.m_pEngine->poll();
+            if (bestMove)
+            {
+                results[slot.m_job] = JobResult{true, slot.m_lastInfo, *bestMove};
+                ++m_stats.m_positions;
+                --remainingJobs;
+                slot.m_job = -1;
+                continue;
+            }
+
+            const bool hasTimedOut = m_jobTimeout.count() > 0 && Clock::now() - slot.m_jobStart >= m_jobTimeout;
+            if (slot.m_pEngine->isRunning() && !hasTimedOut) continue;
+
+            // The engine died or hangs: it is killed here and started again with its next job
+            slot.m_pEngine->quit(std::chrono::milliseconds(0));
+            ++m_stats.m_restarts;
+            failJob(slot.m_job);
+            slot.m_job = -1;
+        }
+    }
+
+    m_stats.m_time = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+    return results;
+}
+
+void EnginePool::annotate(MoveTree& tree_, const UCIGoLimits& limits_, const std::string& initialFen_)
+{
+    std::vector<Job> jobs;
+    std::vector<NodeIndex> nodes;
+
+    // Depth first over every variation, each node being searched after the moves leading to it
+    std::vector<std::pair<NodeIndex, std::vector<std::string>>> toVisit{{MoveTree::g_ROOT, {}}};
+    while (!toVisit.empty())
+    {
+        auto [node, moves] = std::move(toVisit.back());
+        toVisit.pop_back();
+
+        if (const auto& pMove = tree_.getMove(node))
+        {
+            moves.push_back(toLongAlgebraic(*pMove));
+            jobs.push_back(Job{initialFen_, moves});
+            nodes.push_back(node);
+        }
+
+        // Pushed last to first so that the main line comes out first
+        const size_t firstChild = toVisit.size();
+        for (NodeIndex child = tree_.getNode(node).m_firstChild; child != g_NO_NODE; child = tree_.getNode(child).m_nextSibling)
+            toVisit.emplace_back(child, moves);
+        std::reverse(toVisit.begin() + firstChild, toVisit.end());
+    }
+
+    const std::vector<JobResult> results = run(jobs, limits_);
+
+    const bool isWhiteFirst = initialFen_.empty() || isWhiteToMove(initialFen_);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        if (!results[i].m_isValid) continue;
+
+        // Engines score for the side to move, which changes with every move
+        const bool isWhiteToMoveAfter = (jobs[i].m_moves.size() % 2 == 0) == isWhiteFirst;
+        const int sign = isWhiteToMoveAfter? 1: -1;
+        const UCIInfo& info = results[i].m_info;
+
+        MoveEvaluation evaluation;
+        evaluation.m_centipawns = sign * info.m_centipawns.value_or(0);
+        if (info.m_mate) evaluation.m_mate = sign * *info.m_mate;
+        evaluation.m_depth = info.m_depth;
+        evaluation.m_bestMove = results[i].m_bestMove.m_move;
+
+        MoveAnnotation& annotation = tree_.annotate(nodes[i]);
+        setEvalComment(annotation.m_comment, evaluation);
+        annotation.m_evaluation = evaluation;
+    }
+}
+
+bool EnginePool::startEngine(Slot& slot_)
+{
+    slot_.m_pEngine = std::make_unique<UCIEngine>(m_command, m_arguments);
+    if (!slot_.m_pEngine->start()) return false;
+
+    for (const auto& [name, value]: m_options) slot_.m_pEngine->setOption(name, value);
+    return slot_.m_pEngine->isReady();
+}
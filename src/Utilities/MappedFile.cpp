@@ -0,0 +1,42 @@
+#include "../../include/Utilities/MappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& fileName_)
+{
+    const int fd = open(fileName_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return;
+
+    struct stat status;
+    if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode))
+    {
+        m_size = static_cast<size_t>(status.st_size);
+        if (m_size == 0)
+        {
+            m_isOpen = true; // Nothing to map
+        }
+        else
+        {
+            void* pData = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pData != MAP_FAILED)
+            {
+                // The file is read once from start to end
+                madvise(pData, m_size, MADV_SEQUENTIAL);
+                m_pData = pData;
+                m_isOpen = true;
+            }
+        }
+    }
+
+    // The mapping stays valid without the descriptor
+    close(fd);
+    if (!m_isOpen) m_size = 0;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_pData) munmap(m_pData, m_size);
+}
@@ -0,0 +1,174 @@
+#include "../../include/Utilities/PGNChecker.hpp"
+#include "../../include/Utilities/WorkStealingPool.hpp"
+#include "../../include/Logic/Board.hpp"
+#include "../../include/Logic/SAN.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+    // Chunks in flight per thread, enough to keep every thread busy while
+    // the reports of a batch are handed out
+    constexpr size_t g_CHUNKS_PER_THREAD = 4;
+}
+
+PGNChecker::PGNChecker(unsigned threadCount_, size_t chunkSize_):
+    m_threadCount(std::max(threadCount_, 1u)),
+    m_chunkSize(chunkSize_),
+    m_startPosition(Board().getPosition())
+{
+}
+
+// A variation replaces the move before it, so each line keeps the position
+// that move was played from
+PGNChecker::GameReport PGNChecker::checkGame(const PGNGame& game_) const
+{
+    struct Line
+    {
+        Position m_position;
+        Position m_previousPosition;
+        int m_movesLost = 0; // From the first illegal move on, nothing more can be checked
+    };
+
+    GameReport report;
+    report.m_result = game_.m_result;
+    report.m_errors = game_.m_errors;
+
+    // Games from untrusted archives may come with any FEN
+    const std::string_view fen = game_.getTag("FEN");
+    if (!fen.empty())
+    {
+        const std::string problem = Board::checkFEN(fen);
+        if (!problem.empty())
+        {
+            report.m_errors.push_back("invalid FEN tag: " + problem);
+            return report;
+        }
+    }
+    const Position start = fen.empty()? m_startPosition: Board(std::string(fen)).getPosition();
+    std::vector<Line> lines{{start, start}};
+
+    for (const auto& element: game_.m_movetext)
+    {
+        if (element.m_type == PGNElement::Type::VARIATION_START)
+        {
+            // A variation replacing the illegal move itself can still be checked
+            const Line& line = lines.back();
+            if (line.m_movesLost == 0) lines.push_back({line.m_previousPosition, line.m_previousPosition});
+            else if (line.m_movesLost == 1) lines.push_back({line.m_position, line.m_position});
+            else lines.push_back({line.m_position, line.m_position, line.m_movesLost});
+            continue;
+        }
+        if (element.m_type == PGNElement::Type::VARIATION_END)
+        {
+            lines.pop_back();
+            continue;
+        }
+        if (element.m_type != PGNElement::Type::MOVE) continue;
+
+        Line& line = lines.back();
+        if (line.m_movesLost > 0)
+        {
+            ++line.m_movesLost;
+            continue;
+        }
+
+        const CompactMove move = san::parseMove(line.m_position, element.m_text);
+        if (move.isNull())
+        {
+            report.m_errors.push_back("ply " + std::to_string(report.m_plies + 1) + ": illegal or ambiguous move " + std::string(element.m_text));
+            line.m_movesLost = 1;
+            continue;
+        }
+        line.m_previousPosition = line.m_position;
+        line.m_position.makeMove(move);
+        ++report.m_plies;
+    }
+
+    const std::string_view resultTag = game_.getTag("Result");
+    if (!resultTag.empty() && resultTag != game_.m_result)
+        report.m_errors.push_back("result " + std::string(game_.m_result) + " differs from the Result tag");
+    return report;
+}
+
+void PGNChecker::checkStream(std::istream& input_, const ReportCallback& onReport_) const
+{
+    PGNReader reader(input_);
+    checkGames(reader, onReport_);
+}
+
+void PGNChecker::checkText(std::string_view text_, const ReportCallback& onReport_) const
+{
+    if (m_threadCount == 1)
+    {
+        PGNReader reader(text_);
+        checkGames(reader, onReport_);
+        return;
+    }
+
+    const std::vector<std::string_view> chunks = splitIntoChunks(text_, m_chunkSize);
+    const size_t batchSize = m_threadCount * g_CHUNKS_PER_THREAD;
+    WorkStealingPool pool(m_threadCount);
+
+    size_t gameCount = 0;
+    std::vector<std::vector<GameReport>> batchReports(batchSize);
+    for (size_t batchStart = 0; batchStart < chunks.size(); batchStart += batchSize)
+    {
+        const size_t batchEnd = std::min(batchStart + batchSize, chunks.size());
+        for (size_t chunk = batchStart; chunk < batchEnd; ++chunk)
+        {
+            std::vector<GameReport>& reports = batchReports[chunk - batchStart];
+            reports.clear();
+            pool.submit([this, &reports, text = chunks[chunk]]()
+            {
+                PGNReader reader(text);
+                PGNGame game;
+                while (reader.readGame(game)) reports.push_back(checkGame(game));
+            });
+        }
+        pool.wait();
+
+        // Merged in the order of the file
+        for (size_t chunk = batchStart; chunk < batchEnd; ++chunk)
+        {
+            for (auto& report: batchReports[chunk - batchStart])
+            {
+                report.m_index = ++gameCount;
+                onReport_(report);
+            }
+        }
+    }
+}
+
+void PGNChecker::checkGames(PGNReader& reader_, const ReportCallback& onReport_) const
+{
+    PGNGame game;
+    while (reader_.readGame(game))
+    {
+        GameReport report = checkGame(game);
+        report.m_index = reader_.getGameCount();
+        onReport_(report);
+    }
+}
+
+std::vector<std::string_view> PGNChecker::splitIntoChunks(std::string_view text_, size_t chunkSize_)
+{
+    assert(chunkSize_ > 0);
+    constexpr std::string_view gameStart = "\n[Event ";
+
+    std::vector<std::string_view> chunks;
+    size_t chunkStart = 0;
+    while (chunkStart < text_.size())
+    {
+        size_t chunkEnd = text_.size();
+        if (text_.size() - chunkStart > chunkSize_)
+        {
+            const size_t boundary = text_.find(gameStart, chunkStart + chunkSize_ - 1);
+            if (boundary != std::string_view::npos) chunkEnd = boundary + 1;
+        }
+        chunks.push_back(text_.substr(chunkStart, chunkEnd - chunkStart));
+        chunkStart = chunkEnd;
+    }
+    return chunks;
+}
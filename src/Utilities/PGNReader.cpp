@@ -0,0 +1,156 @@
+#include "../../include/Utilities/PGNReader.hpp"
+
+std::string_view PGNGame::getTag(std::string_view name_) const
+{
+    for (const auto& [name, value]: m_tags)
+        if (name == name_) return value;
+    return std::string_view();
+}
+
+void PGNGame::clear()
+{
+    m_tags.clear();
+    m_movetext.clear();
+    m_result = std::string_view();
+    m_errors.clear();
+}
+
+PGNReader::PGNReader(std::istream& input_):
+    m_pInput(&input_),
+    m_tokenizer(std::string_view())
+{
+}
+
+PGNReader::PGNReader(std::string_view text_):
+    m_tokenizer(text_)
+{
+}
+
+bool PGNReader::readGame(PGNGame& game_)
+{
+    game_.clear();
+    if (m_pInput)
+    {
+        if (!readGameText()) return false;
+        m_tokenizer = PGNTokenizer(m_gameText);
+    }
+    if (!parseGame(game_)) return false;
+
+    ++m_gameCount;
+    return true;
+}
+
+// Gathers the lines of the next game of the stream
+bool PGNReader::readGameText()
+{
+    m_gameText.clear();
+
+    bool hasMovetext = false;
+    bool isInComment = false; // In a brace comment left open on a previous line
+    while (m_hasPendingLine || readLine())
+    {
+        m_hasPendingLine = false;
+
+        // An unterminated comment must not swallow the games that follow
+        const bool isTagPair = !m_line.empty() && m_line[0] == '[' && (!isInComment || m_line.compare(0, 7, "[Event ") == 0);
+        if (isTagPair && hasMovetext)
+        {
+            m_hasPendingLine = true;
+            break;
+        }
+
+        if (isTagPair)
+        {
+            isInComment = false;
+        }
+        else if (m_line.empty() || m_line[0] != '%')
+        {
+            for (char c: m_line)
+            {
+                if (isInComment) isInComment = (c != '}');
+                else if (c == '{') isInComment = true;
+                else if (c == ';') break;
+            }
+            hasMovetext = hasMovetext || m_line.find_first_not_of(" \t") != std::string::npos;
+        }
+
+        m_gameText += m_line;
+        m_gameText += '\n';
+    }
+    return !m_gameText.empty();
+}
+
+bool PGNReader::readLine()
+{
+    if (!std::getline(*m_pInput, m_line)) return false;
+    if (!m_line.empty() && m_line.back() == '\r') m_line.pop_back();
+    return true;
+}
+
+// Reads tokens up to the end of the game. False if there was none.
+bool PGNReader::parseGame(PGNGame& game_)
+{
+    typedef PGNToken::Type Type;
+
+    bool hasToken = false;
+    bool hasMovetext = false;
+    int variationDepth = 0;
+    PGNToken token;
+    for (size_t offset = m_tokenizer.getOffset(); m_tokenizer.next(token); offset = m_tokenizer.getOffset())
+    {
+        if (token.m_type == Type::TAG_PAIR && hasMovetext)
+        {
+            // First tag of the next game
+            m_tokenizer.setOffset(offset);
+            break;
+        }
+        hasToken = true;
+        hasMovetext = hasMovetext || token.m_type != Type::TAG_PAIR;
+
+        switch (token.m_type)
+        {
+            case Type::TAG_PAIR:
+                game_.m_tags.emplace_back(token.m_text, token.m_value);
+                break;
+            case Type::MOVE:
+                game_.m_movetext.push_back({PGNElement::Type::MOVE, token.m_text});
+                break;
+            case Type::COMMENT:
+                game_.m_movetext.push_back({PGNElement::Type::COMMENT, token.m_text});
+                break;
+            case Type::NAG:
+                game_.m_movetext.push_back({PGNElement::Type::NAG, token.m_text});
+                break;
+            case Type::VARIATION_START:
+                ++variationDepth;
+                game_.m_movetext.push_back({PGNElement::Type::VARIATION_START, token.m_text});
+                break;
+            case Type::VARIATION_END:
+                if (variationDepth == 0)
+                {
+                    game_.m_errors.push_back("unbalanced ')'");
+                    break;
+                }
+                --variationDepth;
+                game_.m_movetext.push_back({PGNElement::Type::VARIATION_END, token.m_text});
+                break;
+            case Type::RESULT:
+                if (variationDepth > 0) game_.m_errors.push_back("result inside a variation");
+                else game_.m_result = token.m_text;
+                break;
+            case Type::ERROR:
+                game_.m_errors.emplace_back(token.m_text);
+                break;
+        }
+    }
+    if (!hasToken) return false;
+
+    if (variationDepth > 0)
+    {
+        // Closed here so that readers can rely on the nesting
+        game_.m_errors.push_back("unterminated variation");
+        for (; variationDepth > 0; --variationDepth) game_.m_movetext.push_back({PGNElement::Type::VARIATION_END, std::string_view()});
+    }
+    if (game_.m_result.empty()) game_.m_result = "*";
+    return true;
+}
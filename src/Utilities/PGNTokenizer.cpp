@@ -0,0 +1,173 @@
+#include "../../include/Utilities/PGNTokenizer.hpp"
+
+#include <cctype>
+
+namespace
+{
+    bool isSpace(char c_) { return std::isspace(static_cast<unsigned char>(c_)); }
+    bool isDigit(char c_) { return std::isdigit(static_cast<unsigned char>(c_)); }
+
+    // Characters that end a move, a move number or a result
+    bool isDelimiter(char c_)
+    {
+        return isSpace(c_) || std::string_view("{};()[]$").find(c_) != std::string_view::npos;
+    }
+
+    bool isResult(std::string_view token_)
+    {
+        return token_ == "1-0" || token_ == "0-1" || token_ == "1/2-1/2" || token_ == "*";
+    }
+
+    // Glyphs that may stand apart from their move, as a short form of NAGs 1 to 6
+    bool isSuffixAnnotation(std::string_view token_)
+    {
+        return token_ == "!" || token_ == "?" || token_ == "!!" || token_ == "??" || token_ == "!?" || token_ == "?!";
+    }
+}
+
+bool PGNTokenizer::next(PGNToken& token_)
+{
+    typedef PGNToken::Type Type;
+
+    while (m_offset < m_text.size())
+    {
+        const char c = m_text[m_offset];
+        if (isSpace(c))
+        {
+            ++m_offset;
+            continue;
+        }
+        if (c == '%' && isAtLineStart(m_offset))
+        {
+            m_offset = findLineEnd(m_offset) + 1;
+            continue;
+        }
+
+        token_.m_value = std::string_view();
+        switch (c)
+        {
+            case '[':
+                readTagPair(token_);
+                return true;
+            case '{':
+                readComment(token_);
+                return true;
+            case ';':
+            {
+                const size_t end = findLineEnd(m_offset);
+                token_ = {Type::COMMENT, m_text.substr(m_offset + 1, end - m_offset - 1)};
+                m_offset = end + 1;
+                return true;
+            }
+            case '(':
+            case ')':
+                token_ = {(c == '(')? Type::VARIATION_START: Type::VARIATION_END, m_text.substr(m_offset, 1)};
+                ++m_offset;
+                return true;
+            case '$':
+            {
+                size_t end = m_offset + 1;
+                while (end < m_text.size() && isDigit(m_text[end])) ++end;
+                token_ = {Type::NAG, m_text.substr(m_offset + 1, end - m_offset - 1)};
+                m_offset = end;
+                return true;
+            }
+            case '}':
+            case ']':
+                token_ = {Type::ERROR, (c == '}')? "unexpected '}'": "unexpected ']'"};
+                ++m_offset;
+                return true;
+            default:
+            {
+                readSymbol(token_);
+                if (token_.m_text.empty()) continue; // Move number
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t PGNTokenizer::findLineEnd(size_t offset_) const
+{
+    const size_t end = m_text.find('\n', offset_);
+    return (end == std::string_view::npos)? m_text.size(): end;
+}
+
+// [Name "Value"], on one line
+void PGNTokenizer::readTagPair(PGNToken& token_)
+{
+    const size_t lineEnd = findLineEnd(m_offset);
+    const std::string_view line = m_text.substr(m_offset, lineEnd - m_offset);
+
+    const size_t nameStart = line.find_first_not_of(" \t", 1);
+    const size_t nameEnd = line.find_first_of(" \t\"]", nameStart);
+    const size_t valueStart = line.find('"', nameEnd);
+    size_t valueEnd = valueStart;
+    if (valueStart != std::string_view::npos)
+    {
+        // Quotes inside the value are escaped with a backslash
+        valueEnd = valueStart + 1;
+        while (valueEnd < line.size() && line[valueEnd] != '"') valueEnd += (line[valueEnd] == '\\')? 2: 1;
+    }
+    const size_t tagEnd = (valueEnd < line.size())? line.find(']', valueEnd): std::string_view::npos;
+
+    if (nameStart == std::string_view::npos || valueStart == std::string_view::npos || valueEnd >= line.size() || tagEnd == std::string_view::npos)
+    {
+        token_ = {PGNToken::Type::ERROR, "malformed tag pair"};
+        m_offset = lineEnd + 1;
+        return;
+    }
+
+    token_ = {PGNToken::Type::TAG_PAIR, line.substr(nameStart, nameEnd - nameStart), line.substr(valueStart + 1, valueEnd - valueStart - 1)};
+    m_offset += tagEnd + 1;
+}
+
+// A brace comment may span lines, but one left open does not run into the
+// next game: it ends before a line starting with an Event tag
+void PGNTokenizer::readComment(PGNToken& token_)
+{
+    constexpr std::string_view nextGame = "\n[Event ";
+
+    size_t end = m_offset + 1;
+    while (end < m_text.size() && m_text[end] != '}')
+    {
+        if (m_text[end] == '\n' && m_text.substr(end, nextGame.size()) == nextGame) break;
+        ++end;
+    }
+
+    if (end < m_text.size() && m_text[end] == '}')
+    {
+        token_ = {PGNToken::Type::COMMENT, m_text.substr(m_offset + 1, end - m_offset - 1)};
+        m_offset = end + 1;
+    }
+    else
+    {
+        token_ = {PGNToken::Type::ERROR, "unterminated comment"};
+        m_offset = end;
+    }
+}
+
+// Move or result, past its move number if any. Leaves an empty MOVE token
+// for a bare move number.
+void PGNTokenizer::readSymbol(PGNToken& token_)
+{
+    size_t end = m_offset;
+    while (end < m_text.size() && !isDelimiter(m_text[end])) ++end;
+    std::string_view symbol = m_text.substr(m_offset, end - m_offset);
+    m_offset = end;
+
+    // "12." and "12..." may be glued to the move that follows
+    size_t moveStart = 0;
+    while (moveStart < symbol.size() && isDigit(symbol[moveStart])) ++moveStart;
+    if (moveStart < symbol.size() && symbol[moveStart] == '.')
+    {
+        while (moveStart < symbol.size() && symbol[moveStart] == '.') ++moveStart;
+        symbol.remove_prefix(moveStart);
+    }
+
+    PGNToken::Type type = PGNToken::Type::MOVE;
+    if (isResult(symbol)) type = PGNToken::Type::RESULT;
+    else if (isSuffixAnnotation(symbol)) type = PGNToken::Type::NAG;
+    token_ = {type, symbol};
+}
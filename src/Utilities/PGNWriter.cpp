@@ -0,0 +1,187 @@
+#include "../../include/Utilities/PGNWriter.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+namespace
+{
+    // Plies played before the first move of a game set up with fen_, from
+    // its side to move and move number
+    int firstPlyFromFEN(std::string_view fen_)
+    {
+        std::vector<std::string_view> fields;
+        for (size_t start = 0; start < fen_.size();)
+        {
+            size_t end = fen_.find(' ', start);
+            if (end == std::string_view::npos) end = fen_.size();
+            if (end > start) fields.push_back(fen_.substr(start, end - start));
+            start = end + 1;
+        }
+
+        int moveNumber = 1;
+        if (fields.size() > 5) std::from_chars(fields[5].data(), fields[5].data() + fields[5].size(), moveNumber);
+        const bool isBlackToMove = fields.size() > 1 && fields[1] == "b";
+        return 2 * (std::max(moveNumber, 1) - 1) + (isBlackToMove? 1: 0);
+    }
+}
+
+PGNWriter::PGNWriter(size_t capacity_):
+    m_capacity(capacity_)
+{
+    m_buffer.reserve(m_capacity);
+}
+
+PGNWriter::PGNWriter(std::ostream& output_, size_t capacity_):
+    m_pOutput(&output_),
+    m_capacity(capacity_)
+{
+    m_buffer.reserve(m_capacity);
+}
+
+PGNWriter::~PGNWriter()
+{
+    flush();
+}
+
+void PGNWriter::flush()
+{
+    if (!m_pOutput) return;
+    m_pOutput->write(m_buffer.data(), m_buffer.size());
+    m_pOutput->flush();
+    m_buffer.clear();
+    m_lineStart = 0;
+}
+
+void PGNWriter::writeGame(const MoveTree& tree_, const Tags& tags_, std::string_view result_)
+{
+    m_firstPly = 0;
+    for (const auto& [name, value]: tags_)
+    {
+        writeTag(name, value);
+        if (name == "FEN") m_firstPly = firstPlyFromFEN(value);
+    }
+    if (!tags_.empty()) m_buffer += '\n';
+    m_lineStart = m_buffer.size();
+
+    writeContinuation(tree_, MoveTree::g_ROOT, true);
+    writeToken(result_);
+    m_buffer += "\n\n";
+    m_lineStart = m_buffer.size();
+    ++m_gameCount;
+
+    if (m_pOutput && m_buffer.size() >= m_capacity) flush();
+}
+
+// [Name "Value"], with quotes and backslashes escaped
+void PGNWriter::writeTag(std::string_view name_, std::string_view value_)
+{
+    m_buffer += '[';
+    m_buffer.append(name_);
+    m_buffer += " \"";
+    for (size_t start = 0; start < value_.size();)
+    {
+        const size_t end = std::min(value_.find_first_of("\"\\", start), value_.size());
+        m_buffer.append(value_.substr(start, end - start));
+        if (end == value_.size()) break;
+        m_buffer += '\\';
+        m_buffer += value_[end];
+        start = end + 1;
+    }
+    m_buffer += "\"]\n";
+}
+
+// The moves after parent_: its main line, each move followed by the
+// variations that replace it. Only variations recurse.
+void PGNWriter::writeContinuation(const MoveTree& tree_, NodeIndex parent_, bool isNumberNeeded_)
+{
+    for (NodeIndex move = tree_.getNode(parent_).m_firstChild; move != g_NO_NODE; move = tree_.getNode(move).m_firstChild)
+    {
+        isNumberNeeded_ = writeMove(tree_, move, isNumberNeeded_);
+
+        for (NodeIndex variation = tree_.getNode(move).m_nextSibling; variation != g_NO_NODE; variation = tree_.getNode(variation).m_nextSibling)
+        {
+            writeToken("(");
+            m_isAfterParenthesis = true;
+            writeContinuation(tree_, variation, writeMove(tree_, variation, true));
+            startToken(1, true);
+            m_buffer += ')';
+
+            // The main line goes on after the variation
+            isNumberNeeded_ = true;
+        }
+    }
+}
+
+// True if the move after this one needs its number, as black's moves do
+// after a comment
+bool PGNWriter::writeMove(const MoveTree& tree_, NodeIndex node_, bool isNumberNeeded_)
+{
+    std::string_view san = tree_.getSAN(node_);
+    std::string fallback;
+    if (san.empty())
+    {
+        // Trees built without a board
+        fallback = parseMove(*tree_.getMove(node_), 0, false);
+        san = fallback;
+    }
+
+    const int ply = m_firstPly + static_cast<int>(tree_.getNode(node_).m_depth) - 1;
+    if (ply % 2 == 0 || isNumberNeeded_) writeMoveNumber(ply, san.size());
+    writeToken(san);
+
+    const MoveAnnotation* pAnnotation = tree_.getAnnotation(node_);
+    if (!pAnnotation || pAnnotation->m_comment.empty()) return false;
+    writeComment(pAnnotation->m_comment);
+    return true;
+}
+
+// "12." before white's moves, "12..." before black's, on the same line as
+// the move
+void PGNWriter::writeMoveNumber(int ply_, size_t moveLength_)
+{
+    char number[16];
+    char* end = std::to_chars(number, number + sizeof(number) - 3, ply_ / 2 + 1).ptr;
+    *end++ = '.';
+    if (ply_ % 2 != 0)
+    {
+        *end++ = '.';
+        *end++ = '.';
+    }
+    startToken(end - number + 1 + moveLength_);
+    m_buffer.append(number, end - number);
+}
+
+// Braces cannot be escaped in PGN, so closing ones are left out
+void PGNWriter::writeComment(std::string_view comment_)
+{
+    startToken(comment_.size() + 2);
+    m_buffer += '{';
+    for (char c: comment_)
+    {
+        if (c != '}') m_buffer += c;
+    }
+    m_buffer += '}';
+}
+
+void PGNWriter::writeToken(std::string_view token_)
+{
+    startToken(token_.size());
+    m_buffer.append(token_);
+}
+
+// Separates the token to come from the previous one, on a new line if it
+// would not fit on the current one. Glued tokens only move to a new line.
+void PGNWriter::startToken(size_t length_, bool isGlued_)
+{
+    const bool isGlued = isGlued_ || m_isAfterParenthesis;
+    m_isAfterParenthesis = false;
+    if (m_buffer.size() == m_lineStart) return;
+
+    const size_t separatorLength = isGlued? 0: 1;
+    if (m_buffer.size() - m_lineStart + separatorLength + length_ > g_MAX_LINE_LENGTH)
+    {
+        m_buffer += '\n';
+        m_lineStart = m_buffer.size();
+    }
+    else if (!isGlued) m_buffer += ' ';
+}
@@ -1,6 +1,5 @@
 #include "../../include/Logic/Pieces/Piece.hpp"
 #include "../../include/Utilities/PieceTransition.hpp"
-#include "../../include/Application/GameThread.hpp"
 #include <math.h>
 
 // Divide by 6 so the increment is in base 10, that is 60 / 10
@@ -59,7 +58,7 @@ void PieceTransition::setHasArrived()
     m_second_increment = {0, 0};
 }
 
-void PieceTransition::setCapturedPiece(shared_ptr<Piece>& captured, int x, int y)
+void PieceTransition::setCapturedPiece(std::shared_ptr<Piece>& captured, int x, int y)
 {
     m_captured = captured;
     if (m_captured) {
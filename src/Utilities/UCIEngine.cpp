@@ -0,0 +1,351 @@
+#include "../../include/Utilities/UCIEngine.hpp"
+
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    constexpr size_t g_READ_CHUNK_SIZE = 4096;
+
+    std::string readRestOfLine(std::istringstream& stream_)
+    {
+        std::string rest;
+        std::getline(stream_, rest);
+        const size_t start = rest.find_first_not_of(' ');
+        return (start == std::string::npos)? std::string(): rest.substr(start);
+    }
+
+    void setFlag(int fd_, int command_, int flag_)
+    {
+        const int getCommand = (command_ == F_SETFD)? F_GETFD: F_GETFL;
+        fcntl(fd_, command_, fcntl(fd_, getCommand) | flag_);
+    }
+}
+
+UCIInfo parseUCIInfo(const std::string& line_)
+{
+    UCIInfo info;
+    std::istringstream stream(line_);
+    std::string token;
+    stream >> token;
+    if (token != "info") return info;
+
+    while (stream >> token)
+    {
+        if (token == "depth") stream >> info.m_depth;
+        else if (token == "seldepth") stream >> info.m_selectiveDepth;
+        else if (token == "multipv") stream >> info.m_multiPV;
+        else if (token == "nodes") stream >> info.m_nodes;
+        else if (token == "nps") stream >> info.m_nodesPerSecond;
+        else if (token == "hashfull") stream >> info.m_hashFull;
+        else if (token == "currmove") stream >> info.m_currentMove;
+        else if (token == "lowerbound") info.m_isLowerBound = true;
+        else if (token == "upperbound") info.m_isUpperBound = true;
+        else if (token == "time")
+        {
+            long long milliseconds = 0;
+            stream >> milliseconds;
+            info.m_time = std::chrono::milliseconds(milliseconds);
+        }
+        else if (token == "score")
+        {
+            std::string unit;
+            int value = 0;
+            stream >> unit >> value;
+            if (unit == "cp") info.m_centipawns = value;
+            else if (unit == "mate") info.m_mate = value;
+        }
+        else if (token == "pv")
+        {
+            // The variation runs to the end of the line
+            while (stream >> token) info.m_principalVariation.push_back(token);
+        }
+        else if (token == "string")
+        {
+            info.m_string = readRestOfLine(stream);
+        }
+        // Anything else (tbhits, currmovenumber, cpuload...) is skipped, value included
+    }
+    return info;
+}
+
+UCIEngine::UCIEngine(std::string command_, std::vector<std::string> arguments_):
+    m_command(std::move(command_)),
+    m_arguments(std::move(arguments_))
+{
+}
+
+UCIEngine::~UCIEngine()
+{
+    if (isRunning()) quit();
+}
+
+bool UCIEngine::start(std::chrono::milliseconds timeout_)
+{
+    if (isRunning()) return true;
+
+    int inputPipe[2];
+    int outputPipe[2];
+    if (pipe(inputPipe) != 0) return false;
+    if (pipe(outputPipe) != 0)
+    {
+        close(inputPipe[0]);
+        close(inputPipe[1]);
+        return false;
+    }
+
+    // Keep every pipe out of the other engines this process starts
+    for (int fd: {inputPipe[0], inputPipe[1], outputPipe[0], outputPipe[1]}) setFlag(fd, F_SETFD, FD_CLOEXEC);
+
+    // An engine that dies must not take us down when we next write to it
+    std::signal(SIGPIPE, SIG_IGN);
+
+    std::vector<char*> argv;
+    argv.push_back(m_command.data());
+    for (auto& argument: m_arguments) argv.push_back(argument.data());
+    argv.push_back(nullptr);
+
+    m_pid = fork();
+    if (m_pid == 0)
+    {
+        // dup2 clears close-on-exec on the copies
+        dup2(inputPipe[0], STDIN_FILENO);
+        dup2(outputPipe[1], STDOUT_FILENO);
+        execvp(argv[0], argv.data());
+        _exit(127);
+    }
+
+    close(inputPipe[0]);
+    close(outputPipe[1]);
+    m_inputFd = inputPipe[1];
+    m_outputFd = outputPipe[0];
+    if (m_pid < 0)
+    {
+        closeProcess();
+        return false;
+    }
+    setFlag(m_outputFd, F_SETFL, O_NONBLOCK);
+
+    m_name.clear();
+    m_optionNames.clear();
+    m_isUCIOk = false;
+    send("uci");
+    if (!waitFor([this]() { return m_isUCIOk; }, timeout_))
+    {
+        closeProcess();
+        return false;
+    }
+    return true;
+}
+
+void UCIEngine::quit(std::chrono::milliseconds timeout_)
+{
+    if (!isRunning()) return;
+    send("quit");
+    waitFor([this]() { return !isRunning(); }, timeout_);
+    closeProcess();
+}
+
+void UCIEngine::setOption(const std::string& name_, const std::string& value_)
+{
+    send("setoption name " + name_ + " value " + value_);
+}
+
+bool UCIEngine::isReady(std::chrono::milliseconds timeout_)
+{
+    m_isReadyOk = false;
+    send("isready");
+    return waitFor([this]() { return m_isReadyOk; }, timeout_);
+}
+
+void UCIEngine::newGame()
+{
+    send("ucinewgame");
+}
+
+void UCIEngine::setPosition(const std::string& fen_, const std::vector<std::string>& moves_)
+{
+    std::string command = "position fen " + fen_;
+    if (!moves_.empty()) command += " moves";
+    for (const auto& move: moves_) command += ' ' + move;
+    send(command);
+}
+
+void UCIEngine::setStartPosition(const std::vector<std::string>& moves_)
+{
+    std::string command = "position startpos";
+    if (!moves_.empty()) command += " moves";
+    for (const auto& move: moves_) command += ' ' + move;
+    send(command);
+}
+
+void UCIEngine::go(const UCIGoLimits& limits_, InfoCallback onInfo_)
+{
+    std::string command = "go";
+    if (limits_.m_depth) command += " depth " + std::to_string(*limits_.m_depth);
+    if (limits_.m_nodes) command += " nodes " + std::to_string(*limits_.m_nodes);
+    if (limits_.m_moveTime) command += " movetime " + std::to_string(limits_.m_moveTime->count());
+    if (limits_.m_infinite) command += " infinite";
+
+    m_onInfo = std::move(onInfo_);
+    m_bestMove.reset();
+    m_isSearching = true;
+    send(command);
+}
+
+void UCIEngine::stop()
+{
+    if (m_isSearching) send("stop");
+}
+
+std::optional<UCIEngine::BestMove> UCIEngine::poll()
+{
+    readAvailable();
+    std::optional<BestMove> bestMove;
+    bestMove.swap(m_bestMove);
+    return bestMove;
+}
+
+std::optional<UCIEngine::BestMove> UCIEngine::waitForBestMove(std::chrono::milliseconds timeout_)
+{
+    waitFor([this]() { return m_bestMove.has_value(); }, timeout_);
+    return poll();
+}
+
+void UCIEngine::send(const std::string& command_)
+{
+    if (!isRunning()) return;
+
+    const std::string line = command_ + '\n';
+    size_t written = 0;
+    while (written < line.size())
+    {
+        const ssize_t count = write(m_inputFd, line.data() + written, line.size() - written);
+        if (count < 0 && errno == EINTR) continue;
+        if (count < 0)
+        {
+            closeProcess(); // The engine is gone
+            return;
+        }
+        written += count;
+    }
+}
+
+void UCIEngine::readAvailable()
+{
+    if (!isRunning()) return;
+
+    bool isClosed = false;
+    char chunk[g_READ_CHUNK_SIZE];
+    while (true)
+    {
+        const ssize_t count = read(m_outputFd, chunk, sizeof(chunk));
+        if (count > 0)
+        {
+            m_readBuffer.append(chunk, count);
+            continue;
+        }
+        if (count < 0 && errno == EINTR) continue;
+        isClosed = (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK));
+        break;
+    }
+
+    size_t lineStart = 0;
+    for (size_t lineEnd = m_readBuffer.find('\n'); lineEnd != std::string::npos; lineEnd = m_readBuffer.find('\n', lineStart))
+    {
+        size_t length = lineEnd - lineStart;
+        if (length > 0 && m_readBuffer[lineEnd - 1] == '\r') --length;
+        handleLine(m_readBuffer.substr(lineStart, length));
+        lineStart = lineEnd + 1;
+    }
+    m_readBuffer.erase(0, lineStart);
+
+    if (isClosed) closeProcess();
+}
+
+void UCIEngine::handleLine(const std::string& line_)
+{
+    std::istringstream stream(line_);
+    std::string token;
+    stream >> token;
+
+    if (token == "info")
+    {
+        if (m_onInfo) m_onInfo(parseUCIInfo(line_));
+    }
+    else if (token == "bestmove")
+    {
+        BestMove bestMove;
+        stream >> bestMove.m_move >> token;
+        if (token == "ponder") stream >> bestMove.m_ponder;
+        if (bestMove.m_move == "(none)") bestMove.m_move.clear();
+
+        m_bestMove = bestMove;
+        m_isSearching = false;
+    }
+    else if (token == "readyok")
+    {
+        m_isReadyOk = true;
+    }
+    else if (token == "uciok")
+    {
+        m_isUCIOk = true;
+    }
+    else if (token == "id")
+    {
+        stream >> token;
+        if (token == "name") m_name = readRestOfLine(stream);
+    }
+    else if (token == "option")
+    {
+        // option name <name, possibly with spaces> type ...
+        const size_t nameStart = line_.find(" name ");
+        const size_t typeStart = line_.find(" type ");
+        if (nameStart != std::string::npos && typeStart != std::string::npos && typeStart > nameStart)
+            m_optionNames.push_back(line_.substr(nameStart + 6, typeStart - nameStart - 6));
+    }
+}
+
+bool UCIEngine::waitFor(const std::function<bool()>& isDone_, std::chrono::milliseconds timeout_)
+{
+    const auto deadline = Clock::now() + timeout_;
+    while (true)
+    {
+        readAvailable();
+        if (isDone_()) return true;
+        if (!isRunning()) return false;
+
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now());
+        if (remaining.count() <= 0) return false;
+
+        // Sleeps until the engine writes something
+        pollfd output{m_outputFd, POLLIN, 0};
+        if (::poll(&output, 1, static_cast<int>(remaining.count())) < 0 && errno != EINTR) return false;
+    }
+}
+
+void UCIEngine::closeProcess()
+{
+    if (m_inputFd >= 0) close(m_inputFd);
+    if (m_outputFd >= 0) close(m_outputFd);
+    m_inputFd = m_outputFd = -1;
+
+    if (m_pid > 0)
+    {
+        if (waitpid(m_pid, nullptr, WNOHANG) == 0)
+        {
+            kill(m_pid, SIGKILL);
+            waitpid(m_pid, nullptr, 0);
+        }
+    }
+    m_pid = -1;
+    m_isSearching = false;
+    m_readBuffer.clear();
+}
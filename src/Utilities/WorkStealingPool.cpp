@@ -0,0 +1,116 @@
+#include "../../include/Utilities/WorkStealingPool.hpp"
+
+#include <cassert>
+#include <limits>
+
+namespace
+{
+    constexpr unsigned g_NOT_A_WORKER = std::numeric_limits<unsigned>::max();
+
+    // Pool and index of the worker running on the current thread, if any
+    thread_local const WorkStealingPool* t_pPool = nullptr;
+    thread_local unsigned t_workerIndex = g_NOT_A_WORKER;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount_)
+{
+    if (threadCount_ == 0) threadCount_ = 1;
+
+    for (unsigned i = 0; i < threadCount_; ++i) m_queues.push_back(std::make_unique<TaskQueue>());
+    for (unsigned i = 0; i < threadCount_; ++i) m_threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_taskAvailable.notify_all();
+    for (auto& thread : m_threads) thread.join();
+}
+
+unsigned WorkStealingPool::getDefaultThreadCount()
+{
+    const unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return (hardwareThreads > 0)? hardwareThreads: 1;
+}
+
+void WorkStealingPool::submit(Task task_)
+{
+    assert(task_);
+
+    const unsigned queueIndex = (t_pPool == this)? t_workerIndex: m_nextQueue++ % m_queues.size();
+    {
+        // Counted before the task becomes visible, so that a worker never
+        // picks it up ahead of the counters
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_pendingTasks;
+        ++m_queuedTasks;
+
+        TaskQueue& queue = *m_queues[queueIndex];
+        std::lock_guard<std::mutex> queueLock(queue.m_mutex);
+        queue.m_tasks.push_back(std::move(task_));
+    }
+    m_taskAvailable.notify_one();
+}
+
+void WorkStealingPool::wait()
+{
+    assert(t_pPool != this); // A worker waiting on its own pool would never return
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_allTasksDone.wait(lock, [this] { return m_pendingTasks == 0; });
+}
+
+void WorkStealingPool::workerLoop(unsigned index_)
+{
+    t_pPool = this;
+    t_workerIndex = index_;
+
+    Task task;
+    while (true)
+    {
+        if (popTask(index_, task) || stealTask(index_, task))
+        {
+            --m_queuedTasks;
+            task();
+            task = nullptr;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pendingTasks == 0) m_allTasksDone.notify_all();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskAvailable.wait(lock, [this] { return m_stopping || m_queuedTasks > 0; });
+        if (m_stopping && m_queuedTasks == 0) return;
+    }
+}
+
+bool WorkStealingPool::popTask(unsigned index_, Task& task_)
+{
+    TaskQueue& queue = *m_queues[index_];
+    std::lock_guard<std::mutex> lock(queue.m_mutex);
+    if (queue.m_tasks.empty()) return false;
+
+    task_ = std::move(queue.m_tasks.back());
+    queue.m_tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::stealTask(unsigned index_, Task& task_)
+{
+    for (size_t offset = 1; offset < m_queues.size(); ++offset)
+    {
+        TaskQueue& queue = *m_queues[(index_ + offset) % m_queues.size()];
+        std::lock_guard<std::mutex> lock(queue.m_mutex);
+        if (queue.m_tasks.empty()) continue;
+
+        task_ = std::move(queue.m_tasks.front());
+        queue.m_tasks.pop_front();
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,80 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Engine/AnalysisWorker.hpp"
+#include "../include/Logic/Board.hpp"
+#include "BoardPositionsUtil.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    constexpr size_t g_TEST_HASH_ENTRIES = 1 << 14;
+
+    // Polls like the game loop would, until the final update or the timeout
+    std::vector<engine::AnalysisUpdate> pollUntilFinal(engine::AnalysisWorker& worker_, std::chrono::seconds timeout_)
+    {
+        std::vector<engine::AnalysisUpdate> updates;
+        const auto deadline = std::chrono::steady_clock::now() + timeout_;
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            engine::AnalysisUpdate update;
+            while (worker_.pollUpdate(update)) updates.push_back(update);
+            if (!updates.empty() && updates.back().m_isFinal) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return updates;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(AnalysisWorkerTests)
+
+BOOST_AUTO_TEST_CASE(TestUpdatesAreStreamed)
+{
+    engine::AnalysisWorker worker(1, g_TEST_HASH_ENTRIES);
+    const Board board(testUtil::FEN_DEFAULT_POSITION);
+
+    engine::SearchLimits limits;
+    limits.m_depth = 4;
+    worker.analyse(board.getPosition(), limits);
+
+    const auto updates = pollUntilFinal(worker, std::chrono::seconds(60));
+    BOOST_REQUIRE_EQUAL(updates.size(), 5); // One per iteration, then the final result
+    for (int depth = 1; depth <= 4; ++depth)
+    {
+        BOOST_CHECK_EQUAL(updates[depth - 1].m_result.m_depth, depth);
+        BOOST_CHECK(!updates[depth - 1].m_isFinal);
+    }
+    BOOST_CHECK(updates.back().m_isFinal);
+    BOOST_CHECK_EQUAL(updates.back().m_result.m_depth, 4);
+    BOOST_CHECK_EQUAL(updates.back().m_positionHash, board.hash());
+}
+
+BOOST_AUTO_TEST_CASE(TestNewAnalysisCancelsThePreviousOne)
+{
+    engine::AnalysisWorker worker(1, g_TEST_HASH_ENTRIES);
+    const Board first(testUtil::FEN_DEFAULT_POSITION);
+    const Board second(testUtil::FEN_FRIED_LIVER_ATTACK_FRITZ);
+
+    // Without limits the first analysis would never end
+    worker.analyse(first.getPosition());
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    engine::SearchLimits limits;
+    limits.m_depth = 3;
+    worker.analyse(second.getPosition(), limits);
+
+    const auto updates = pollUntilFinal(worker, std::chrono::seconds(60));
+    BOOST_REQUIRE(!updates.empty());
+    BOOST_CHECK(updates.back().m_isFinal);
+    for (const auto& update: updates) BOOST_CHECK_EQUAL(update.m_positionHash, second.hash());
+
+    // Nothing is published once cancelled, and the worker can be destroyed while searching
+    worker.cancel();
+    engine::AnalysisUpdate update;
+    BOOST_CHECK(!worker.pollUpdate(update));
+    worker.analyse(first.getPosition());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
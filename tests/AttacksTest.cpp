@@ -0,0 +1,57 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Attacks.hpp"
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/Pieces/Queen.hpp"
+#include "BoardPositionsUtil.hpp"
+
+namespace
+{
+    Bitboard targetsOf(const std::vector<Move>& moves_)
+    {
+        Bitboard targets = bitboard::g_EMPTY;
+        for (const auto& move : moves_)
+            targets |= bitboard::squareMask(bitboard::toSquare(move.getTarget().first, move.getTarget().second));
+        return targets;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(AttacksTests)
+
+BOOST_AUTO_TEST_CASE(TestTablesMatchRayWalkers)
+{
+    BOOST_CHECK(attacks::selfCheck(1024));
+}
+
+BOOST_AUTO_TEST_CASE(TestEmptyBoardAttacks)
+{
+    const int d4 = bitboard::toSquare(3, 4);
+    BOOST_CHECK_EQUAL(bitboard::popCount(attacks::getRookAttacks(d4, bitboard::g_EMPTY)), 14);
+    BOOST_CHECK_EQUAL(bitboard::popCount(attacks::getBishopAttacks(d4, bitboard::g_EMPTY)), 13);
+    BOOST_CHECK_EQUAL(bitboard::popCount(attacks::getQueenAttacks(d4, bitboard::g_EMPTY)), 27);
+
+    const int a8 = bitboard::toSquare(0, 0);
+    BOOST_CHECK_EQUAL(attacks::getRookAttacks(a8, bitboard::g_EMPTY),
+                      (bitboard::g_RANK_8 | bitboard::g_FILE_A) & ~bitboard::squareMask(a8));
+}
+
+BOOST_AUTO_TEST_CASE(TestQueenMovesMatchRayWalkers)
+{
+    Board board(testUtil::FEN_SCOTCH_MAINLINE);
+    const Position& position = board.getPosition();
+
+    // Black queen on f6
+    const auto& pQueen = board.getBoardTile({'f', 6});
+    BOOST_CHECK_EQUAL(pQueen->getType(), PieceType::QUEEN);
+
+    const int square = bitboard::toSquare(5, 2);
+    const Bitboard expected =
+        (attacks::getRookAttacksByRayWalk(square, position.getOccupancy()) |
+         attacks::getBishopAttacksByRayWalk(square, position.getOccupancy())) &
+        ~position.getOccupancy(Team::BLACK);
+
+    BOOST_CHECK_EQUAL(targetsOf(pQueen->calcPossibleMoves(board)), expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -122,4 +122,16 @@ namespace testUtil
     // |R|N|B| |K|B|N|R|
     // +-+-+-+-+-+-+-+-+
     inline const std::string FEN_FOOLS_CHECKMATE_REVERSED = "rnbqkbnr/ppppp2p/5p2/6pQ/3PP3/8/PPP2PPP/RNB1KBNR w KQkq - 0 1";
+
+    // +-+-+-+-+-+-+-+-+
+    // |r| | | |k| | |r|
+    // | | | | | | | | |
+    // | | | | | | | | |
+    // | |b| | | | | | |
+    // | | | | | | | | |
+    // | | | | | | | | |
+    // | | | | | | | | |
+    // |R| | | |K| | |R|
+    // +-+-+-+-+-+-+-+-+
+    inline const std::string FEN_CASTLING_THROUGH_CHECK = "r3k2r/8/8/1b6/8/8/8/R3K2R w KQkq - 0 1";
 }
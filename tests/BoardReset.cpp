@@ -1,7 +1,6 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
-#include "../include/Application/GameThread.hpp"
 #include "../include/Logic/Board.hpp"
 #include "../include/Logic/Pieces/Piece.hpp"
 
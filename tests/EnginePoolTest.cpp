@@ -0,0 +1,166 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/EnginePool.hpp"
+#include "../include/Utilities/PGNParser.hpp"
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveTreeManager.hpp"
+
+namespace
+{
+    const std::string g_FAKE_ENGINE_SCRIPT = "tests/FakeUCIEngine.py";
+
+    UCIGoLimits depthLimit(int depth_)
+    {
+        UCIGoLimits limits;
+        limits.m_depth = depth_;
+        return limits;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(EnginePoolTests)
+
+BOOST_AUTO_TEST_CASE(TestEveryJobIsSearched)
+{
+    EnginePool pool("python3", {g_FAKE_ENGINE_SCRIPT}, 3);
+    BOOST_CHECK_EQUAL(pool.getEngineCount(), 3);
+
+    std::vector<EnginePool::Job> jobs;
+    for (size_t i = 0; i < 10; ++i) jobs.push_back({"", std::vector<std::string>(i, "e2e4")});
+    const auto results = pool.run(jobs, depthLimit(2));
+
+    BOOST_REQUIRE_EQUAL(results.size(), jobs.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        BOOST_CHECK(results[i].m_isValid);
+        BOOST_CHECK_EQUAL(results[i].m_bestMove.m_move, "e2e4");
+        BOOST_CHECK_EQUAL(results[i].m_info.m_depth, 2);
+        BOOST_CHECK_EQUAL(results[i].m_info.m_centipawns.value_or(-1), static_cast<int>(10 * i));
+    }
+    BOOST_CHECK_EQUAL(pool.getStats().m_positions, 10);
+    BOOST_CHECK_EQUAL(pool.getStats().m_restarts, 0);
+    BOOST_CHECK_GT(pool.getStats().getPositionsPerSecond(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestFailedEnginesAreRestarted)
+{
+    // Each process dies on its third search
+    EnginePool pool("python3", {g_FAKE_ENGINE_SCRIPT, "--crash-after", "3"}, 2);
+    pool.setOption("MultiPV", "2");
+
+    const std::vector<EnginePool::Job> jobs(8, EnginePool::Job{"", {"d2d4"}});
+    const auto results = pool.run(jobs, depthLimit(1));
+    for (const auto& result: results) BOOST_CHECK(result.m_isValid);
+    BOOST_CHECK_EQUAL(pool.getStats().m_positions, 8);
+    BOOST_CHECK_GE(pool.getStats().m_restarts, 2);
+
+    // A search that never ends counts as a failure, until the job is given up
+    pool.setJobTimeout(std::chrono::milliseconds(100));
+    UCIGoLimits infinite;
+    infinite.m_infinite = true;
+    const auto timedOut = pool.run({EnginePool::Job{}}, infinite);
+    BOOST_CHECK(!timedOut.front().m_isValid);
+    BOOST_CHECK_EQUAL(pool.getStats().m_restarts, EnginePool::g_MAX_ATTEMPTS);
+}
+
+BOOST_AUTO_TEST_CASE(TestMissingEngine)
+{
+    EnginePool pool("./no-such-engine", {}, 2);
+    const auto results = pool.run({EnginePool::Job{}, EnginePool::Job{}}, depthLimit(1));
+    for (const auto& result: results) BOOST_CHECK(!result.m_isValid);
+    BOOST_CHECK_EQUAL(pool.getStats().m_positions, 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestAnnotateMoveTree)
+{
+    Board board;
+    MoveTreeManager manager(board);
+    PGNParser parser(manager);
+    parser.generatedMoveTreeFromPGNSequence("1. e4 e5 2. Nf3 (2. Nc3) 2... Nc6");
+
+    EnginePool pool("python3", {g_FAKE_ENGINE_SCRIPT}, 2);
+    MoveTree& tree = manager.getMoves();
+    pool.annotate(tree, depthLimit(2));
+    BOOST_CHECK_EQUAL(pool.getStats().m_positions, 5);
+
+    // The fake engine scores 10 per move for the side to move, turned here into white's point of view
+    MoveTree::Iterator it = tree.begin();
+    it.goToChild(0);
+    const MoveAnnotation* pE4 = tree.getAnnotation(it.getIndex());
+    BOOST_REQUIRE(pE4 && pE4->m_evaluation);
+    BOOST_CHECK_EQUAL(pE4->m_evaluation->m_centipawns, -10);
+    BOOST_CHECK_EQUAL(pE4->m_evaluation->m_depth, 2);
+    BOOST_CHECK_EQUAL(pE4->m_evaluation->m_bestMove, "e2e4");
+    BOOST_CHECK_EQUAL(pE4->m_comment, "[%eval -0.10]");
+
+    it.goToChild(0);
+    const MoveAnnotation* pE5 = tree.getAnnotation(it.getIndex());
+    BOOST_REQUIRE(pE5 && pE5->m_evaluation);
+    BOOST_CHECK_EQUAL(pE5->m_evaluation->m_centipawns, 20);
+    BOOST_CHECK_EQUAL(it.getChildCount(), 2);
+    for (int i = 0; i < it.getChildCount(); ++i)
+    {
+        const MoveAnnotation* pSecondMove = tree.getAnnotation(tree.getChild(it.getIndex(), i));
+        BOOST_REQUIRE(pSecondMove && pSecondMove->m_evaluation);
+        BOOST_CHECK_EQUAL(pSecondMove->m_evaluation->m_centipawns, -30);
+    }
+    BOOST_REQUIRE(it.goToGrandChild(0));
+    const MoveAnnotation* pNc6 = tree.getAnnotation(it.getIndex());
+    BOOST_REQUIRE(pNc6 && pNc6->m_evaluation);
+    BOOST_CHECK_EQUAL(pNc6->m_comment, "[%eval 0.40]");
+}
+
+BOOST_AUTO_TEST_CASE(TestAnnotateKeepsComments)
+{
+    Board board;
+    MoveTreeManager manager(board);
+    PGNParser parser(manager);
+    parser.generatedMoveTreeFromPGNSequence("1. e4 {Best by test} e5 2. Nf3 {[%eval 9.99] Old} *");
+
+    EnginePool pool("python3", {g_FAKE_ENGINE_SCRIPT}, 2);
+    MoveTree& tree = manager.getMoves();
+    pool.annotate(tree, depthLimit(2));
+
+    // The evaluation is added to the comment, or replaces an earlier one
+    MoveTree::Iterator it = tree.begin();
+    it.goToChild(0);
+    BOOST_CHECK_EQUAL(tree.getAnnotation(it.getIndex())->m_comment, "Best by test [%eval -0.10]");
+    it.goToChild(0);
+    BOOST_CHECK_EQUAL(tree.getAnnotation(it.getIndex())->m_comment, "[%eval 0.20]");
+    it.goToChild(0);
+    BOOST_CHECK_EQUAL(tree.getAnnotation(it.getIndex())->m_comment, "[%eval -0.30] Old");
+
+    // Annotating again leaves a single evaluation
+    pool.annotate(tree, depthLimit(2));
+    BOOST_CHECK_EQUAL(tree.getAnnotation(it.getIndex())->m_comment, "[%eval -0.30] Old");
+}
+
+BOOST_AUTO_TEST_CASE(TestLongAlgebraicNotation)
+{
+    Board board;
+    MoveTreeManager manager(board);
+    PGNParser parser(manager);
+    parser.generatedMoveTreeFromPGNSequence("1. e4 e5 2. Nf3 Nf6 3. Bc4 Bc5 4. O-O");
+
+    std::vector<std::string> moves;
+    for (MoveTree::Iterator it = manager.getMoves().begin(); !it.isAtTheEnd(); ++it)
+        moves.push_back(toLongAlgebraic(*manager.getMoves().getMove(it->m_firstChild)));
+
+    const std::vector<std::string> expected{"e2e4", "e7e5", "g1f3", "g8f6", "f1c4", "f8c5", "e1g1"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(moves.begin(), moves.end(), expected.begin(), expected.end());
+
+    // Promotions keep their piece
+    Board promotionBoard("1r5k/P7/8/8/8/8/8/K7 w - - 0 1");
+    MoveTreeManager promotionManager(promotionBoard);
+    PGNParser promotionParser(promotionManager);
+    promotionParser.generatedMoveTreeFromPGNSequence("1. a8=N (1. axb8=R+) (1. a8=Q)");
+
+    std::vector<std::string> promotions;
+    const MoveTree& tree = promotionManager.getMoves();
+    for (int i = 0; i < 3; ++i) promotions.push_back(toLongAlgebraic(*tree.getMove(tree.getChild(MoveTree::g_ROOT, i))));
+
+    const std::vector<std::string> expectedPromotions{"a7a8n", "a7b8r", "a7a8q"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(promotions.begin(), promotions.end(), expectedPromotions.begin(), expectedPromotions.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
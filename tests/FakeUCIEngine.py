@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# Minimal UCI engine used by the UCIEngine and EnginePool tests. It does not
+# play chess: every search reports one info line per depth and MultiPV line,
+# scoring the best line 10 centipawns per move played since the given
+# position, and the best move only tells apart the start position ("e2e4")
+# from a FEN ("e7e8q", a promotion). The received options and position are
+# echoed in an "info string" line before the first depth.
+#
+# With --crash-after N, the process dies on its Nth "go".
+import os
+import select
+import sys
+
+options = {"Hash": "16", "Threads": "1", "MultiPV": "1"}
+position = "startpos"
+crash_after = int(sys.argv[sys.argv.index("--crash-after") + 1]) if "--crash-after" in sys.argv else 0
+searches = 0
+pending = b""  # Input read but not yet split into lines
+
+
+def read_line(timeout=None):
+    """Next command, None on timeout and "quit" once stdin is closed. Reads
+    the descriptor directly so that select() sees every pending byte."""
+    global pending
+    while b"\n" not in pending:
+        readable, _, _ = select.select([0], [], [], timeout)
+        if not readable:
+            return None
+        chunk = os.read(0, 4096)
+        if not chunk:
+            return "quit"
+        pending += chunk
+    line, pending = pending.split(b"\n", 1)
+    return line.decode().strip()
+
+
+def send(line):
+    sys.stdout.write(line + "\n")
+    sys.stdout.flush()
+
+
+def report(depth):
+    words = position.split()
+    plies = len(words) - words.index("moves") - 1 if "moves" in words else 0
+    for line in range(1, int(options["MultiPV"]) + 1):
+        pv = "e7e8q d2d1n" if position.startswith("fen") else "e2e4 e7e5"
+        send("info depth %d seldepth %d multipv %d score cp %d nodes %d nps 1000 time %d pv %s"
+             % (depth, depth + 2, line, 10 * plies - (line - 1), depth * 100, depth, pv))
+
+
+def best_move():
+    send("bestmove e7e8q ponder d2d1n" if position.startswith("fen") else "bestmove e2e4 ponder e7e5")
+
+
+def go(arguments):
+    global searches
+    searches += 1
+    if searches == crash_after:
+        os._exit(1)
+    send("info string %s position %s" % (" ".join("%s=%s" % item for item in sorted(options.items())), position))
+    if "infinite" in arguments:
+        # Keeps searching until told to stop
+        depth = 1
+        while True:
+            command = read_line(0.01)
+            if command in ("stop", "quit"):
+                best_move()
+                if command == "quit":
+                    sys.exit(0)
+                return
+            report(depth)
+            depth += 1
+    depth = int(arguments[arguments.index("depth") + 1]) if "depth" in arguments else 3
+    for d in range(1, depth + 1):
+        report(d)
+    best_move()
+
+
+while True:
+    words = read_line().split()
+    if not words:
+        continue
+    if words[0] == "uci":
+        send("id name Fake Engine")
+        send("id author chess-game tests")
+        send("option name Hash type spin default 16 min 1 max 1024")
+        send("option name Threads type spin default 1 min 1 max 64")
+        send("option name MultiPV type spin default 1 min 1 max 8")
+        send("uciok")
+    elif words[0] == "isready":
+        send("readyok")
+    elif words[0] == "setoption" and len(words) >= 5:
+        options[words[2]] = words[4]
+    elif words[0] == "position":
+        position = " ".join(words[1:])
+    elif words[0] == "go":
+        go(words[1:])
+    elif words[0] == "quit":
+        break
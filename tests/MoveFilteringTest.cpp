@@ -72,18 +72,14 @@ BOOST_AUTO_TEST_CASE(TestRemovalOfIllegalMoves1)
 {
     initBoard(testUtil::FEN_POSITION_WITH_ILLEGAL_MOVES_1);
 
-    std::vector<Move> allMoves = m_board.getAllCurrentlyAvailableMoves();
+    const MoveList& allMoves = m_board.getAllCurrentlyAvailableMoves();
 
     // Ensure that the illegal moves are filtered out
-    auto& pBlackKing = m_board.getBoardTile({'e', 8});
     int rank = 0, file = 4;
-    const coor2d initialPosition1{file, rank};
-    Move illegalMove1({file + 1, rank}, initialPosition1, pBlackKing, MoveType::NORMAL);
+    const CompactMove illegalMove1(bitboard::toSquare(file, rank), bitboard::toSquare(file + 1, rank), MoveType::NORMAL);
 
-    auto& pBlackPawn = m_board.getBoardTile({'f', 7});
     rank = 0, file = 5;
-    const coor2d initialPosition2{file, rank};
-    Move illegalMove2({file, rank + 1}, initialPosition2, pBlackPawn, MoveType::NORMAL);
+    const CompactMove illegalMove2(bitboard::toSquare(file, rank), bitboard::toSquare(file, rank + 1), MoveType::NORMAL);
 
     for (auto& move : allMoves)
     {
@@ -95,20 +91,16 @@ BOOST_AUTO_TEST_CASE(TestRemovalOfIllegalMoves2)
 {
     initBoard(testUtil::FEN_POSITION_WITH_ILLEGAL_MOVES_2);
 
-    std::vector<Move> allMoves = m_board.getAllCurrentlyAvailableMoves();
+    const MoveList& allMoves = m_board.getAllCurrentlyAvailableMoves();
 
     // In this position king is in check, there is only one move available
     
     // Ensure that the illegal moves are filtered out
-    auto& pBlackKing = m_board.getBoardTile({'e', 8});
     int rank = 0, file = 4;
-    const coor2d initialPosition1{file, rank};
-    Move illegalMove1({file + 1, rank}, initialPosition1, pBlackKing, MoveType::NORMAL);
+    const CompactMove illegalMove1(bitboard::toSquare(file, rank), bitboard::toSquare(file + 1, rank), MoveType::NORMAL);
 
-    auto& pBlackPawn = m_board.getBoardTile({'f', 7});
     rank = 0, file = 5;
-    const coor2d initialPosition2{file, rank};
-    Move illegalMove2({file, rank + 1}, initialPosition2, pBlackPawn, MoveType::NORMAL);
+    const CompactMove illegalMove2(bitboard::toSquare(file, rank), bitboard::toSquare(file, rank + 1), MoveType::NORMAL);
 
     for (auto& move : allMoves)
     {
@@ -116,4 +108,24 @@ BOOST_AUTO_TEST_CASE(TestRemovalOfIllegalMoves2)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestNoCastlingThroughCheck)
+{
+    initBoard(testUtil::FEN_CASTLING_THROUGH_CHECK);
+
+    // The bishop on b5 covers f1, so only queenside castling is allowed
+    int kingSideCastles = 0, queenSideCastles = 0;
+    for (auto move : m_board.getAllCurrentlyAvailableMoves())
+    {
+        if (move.getMoveType() == MoveType::CASTLE_KINGSIDE) ++kingSideCastles;
+        if (move.getMoveType() == MoveType::CASTLE_QUEENSIDE) ++queenSideCastles;
+    }
+    BOOST_CHECK_EQUAL(kingSideCastles, 0);
+    BOOST_CHECK_EQUAL(queenSideCastles, 1);
+
+    // Probing the castling squares must leave the king in place
+    auto& pWhiteKing = m_board.getBoardTile({'e', 1});
+    BOOST_REQUIRE(pWhiteKing);
+    BOOST_CHECK_EQUAL(pWhiteKing->getType(), PieceType::KING);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,190 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveGenerator.hpp"
+#include "../include/Logic/Pieces/King.hpp"
+#include "BoardPositionsUtil.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+
+namespace
+{
+    typedef std::tuple<coor2d, coor2d, MoveType> MoveKey; // Init, target, type
+
+    template <typename MovesT>
+    std::vector<MoveKey> toSortedKeys(const MovesT& moves_)
+    {
+        std::vector<MoveKey> keys;
+        for (const auto& move : moves_) keys.emplace_back(move.getInit(), move.getTarget(), move.getMoveType());
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+
+    // Former generator: pseudo-legal moves of every piece, each one played on
+    // the board to see whether it leaves the king in check
+    std::vector<Move> generateByMakeUnmake(Board& board_)
+    {
+        std::vector<Move> legalMoves;
+        for (int rank = 0; rank < 8; ++rank)
+        {
+            for (int file = 0; file < 8; ++file)
+            {
+                std::shared_ptr<Piece> pPiece = board_.getBoardTile(file, rank);
+                if (!pPiece || pPiece->getTeam() != board_.getTurn()) continue;
+
+                for (const auto& move : pPiece->calcPossibleMoves(board_))
+                {
+                    const auto [targetFile, targetRank] = move.getTarget();
+                    std::shared_ptr<Piece> pTarget = board_.getBoardTile(targetFile, targetRank);
+
+                    board_.setBoardTile(targetFile, targetRank, pPiece, false);
+                    board_.resetBoardTile(file, rank, false);
+                    if (!board_.kingIsChecked()) legalMoves.push_back(move);
+
+                    board_.setBoardTile(file, rank, pPiece, false);
+                    board_.setBoardTile(targetFile, targetRank, pTarget, false);
+                }
+            }
+        }
+        return legalMoves;
+    }
+
+    void checkGeneratorsAgree(const std::string& fen_, Team turn_)
+    {
+        Board board(fen_);
+        board.setTurn(turn_);
+        if (!board.getKing()) return; // Some positions only have one king
+
+        board.updateAllCurrentlyAvailableMoves();
+
+        const auto expected = toSortedKeys(generateByMakeUnmake(board));
+        const auto actual = toSortedKeys(board.getAllCurrentlyAvailableMoves());
+        BOOST_CHECK_MESSAGE(expected == actual, "Generators disagree on " << fen_ << " for " << turn_);
+    }
+
+    bool hasEnPassantMove(const Board& board_)
+    {
+        const auto& moves = board_.getAllCurrentlyAvailableMoves();
+        return std::any_of(moves.begin(), moves.end(), [](CompactMove move_) {
+            return move_.getMoveType() == MoveType::ENPASSANT;
+        });
+    }
+
+    // Plays the double push of the black pawn on c7 and lets white move
+    void pushBlackPawnFromC7ToC5(Board& board_)
+    {
+        auto pPawn = board_.getBoardTile({'c', 7});
+        board_.resetBoardTile(2, 1);
+        board_.setBoardTile(2, 3, pPawn);
+        board_.setLastMovedPiece(pPawn);
+        board_.setLastMoveType(MoveType::INIT_SPECIAL);
+        board_.setTurn(Team::WHITE);
+        board_.updateAllCurrentlyAvailableMoves();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(MoveGeneratorTests)
+
+BOOST_AUTO_TEST_CASE(TestAgreesWithMakeUnmakeFiltering)
+{
+    const std::vector<std::string> fens{
+        testUtil::FEN_DEFAULT_POSITION,
+        testUtil::FEN_SCOTCH_MAINLINE,
+        testUtil::FEN_FRIED_LIVER_ATTACK_FRITZ,
+        testUtil::FEN_POSITION_WITH_ILLEGAL_MOVES_1,
+        testUtil::FEN_POSITION_WITH_ILLEGAL_MOVES_2,
+        testUtil::FEN_KING_IN_CHECK_POSITION,
+        testUtil::FEN_STALEMATE_POSITION,
+        testUtil::FEN_FOOLS_CHECKMATE_REVERSED,
+        testUtil::FEN_CASTLING_THROUGH_CHECK
+    };
+
+    for (const auto& fen : fens)
+    {
+        checkGeneratorsAgree(fen, Team::WHITE);
+        checkGeneratorsAgree(fen, Team::BLACK);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestCheckersAndPins)
+{
+    // The queen on h5 checks the black king through the f7 square left open
+    Board board(testUtil::FEN_KING_IN_CHECK_POSITION);
+    board.setTurn(Team::BLACK);
+
+    const MoveGenerator generator(board.getPosition());
+    BOOST_CHECK(generator.isInCheck());
+    BOOST_CHECK_EQUAL(generator.getCheckers(), bitboard::squareMask(bitboard::toSquare(7, 3)));
+
+    // The bishop on a3 pins nothing, the queen on h5 pins the pawn on f7
+    Board pinned(testUtil::FEN_POSITION_WITH_ILLEGAL_MOVES_1);
+    pinned.setTurn(Team::BLACK);
+    const MoveGenerator pinnedGenerator(pinned.getPosition());
+    BOOST_CHECK(!pinnedGenerator.isInCheck());
+    BOOST_CHECK_EQUAL(pinnedGenerator.getPinnedPieces(), bitboard::squareMask(bitboard::toSquare(5, 1)));
+}
+
+BOOST_AUTO_TEST_CASE(TestEnPassantDiscoveredCheck)
+{
+    // Taking en passant would clear both pawns off the fifth rank and expose
+    // the white king on a5 to the rook on h5
+    Board board("8/2p5/8/KP5r/8/8/8/4k3 b - - 0 1");
+    pushBlackPawnFromC7ToC5(board);
+    BOOST_CHECK(!hasEnPassantMove(board));
+
+    // Without the rook the capture is fine
+    Board control("8/2p5/8/KP6/8/8/8/4k3 b - - 0 1");
+    pushBlackPawnFromC7ToC5(control);
+    BOOST_CHECK(hasEnPassantMove(control));
+}
+
+BOOST_AUTO_TEST_CASE(TestCompactMoveEncoding)
+{
+    const int e2 = bitboard::toSquare(4, 6), e4 = bitboard::toSquare(4, 4);
+    const CompactMove push(e2, e4, MoveType::INIT_SPECIAL);
+    BOOST_CHECK_EQUAL(push.getFrom(), e2);
+    BOOST_CHECK_EQUAL(push.getTo(), e4);
+    BOOST_CHECK(push.getMoveType() == MoveType::INIT_SPECIAL);
+    BOOST_CHECK(push.getInit() == coor2d(4, 6));
+    BOOST_CHECK(!push.isNull());
+    BOOST_CHECK(CompactMove().isNull());
+
+    const CompactMove underPromotion(bitboard::toSquare(0, 1), bitboard::toSquare(1, 0), MoveType::NEWPIECE, PieceType::KNIGHT);
+    BOOST_CHECK(underPromotion.getMoveType() == MoveType::NEWPIECE);
+    BOOST_CHECK_EQUAL(underPromotion.getPromotion(), PieceType::KNIGHT);
+
+    std::ostringstream os;
+    os << push << ' ' << underPromotion;
+    BOOST_CHECK_EQUAL(os.str(), "e2e4 a7b8n");
+}
+
+BOOST_AUTO_TEST_CASE(TestPromotionsAreListedPerPiece)
+{
+    Board board("8/P7/8/8/8/8/8/k6K w - - 0 1");
+    board.updateAllCurrentlyAvailableMoves();
+
+    std::vector<PieceType> promotions;
+    for (auto move : board.getAllCurrentlyAvailableMoves())
+        if (move.getMoveType() == MoveType::NEWPIECE) promotions.push_back(move.getPromotion());
+
+    const std::vector<PieceType> expected{PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT};
+    BOOST_CHECK_EQUAL_COLLECTIONS(promotions.begin(), promotions.end(), expected.begin(), expected.end());
+
+    // Selecting the square on the board picks the queen
+    const auto selectedMove = board.findSelectedMove(board.getBoardTile({'a', 7}), 0, 0);
+    BOOST_REQUIRE(selectedMove.has_value());
+    BOOST_CHECK(selectedMove->getMoveType() == MoveType::NEWPIECE);
+}
+
+BOOST_AUTO_TEST_CASE(TestMaximumNumberOfMovesFits)
+{
+    // Known position with the most legal moves
+    Board board("R6R/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kBNN1KB1 w - - 0 1");
+    board.updateAllCurrentlyAvailableMoves();
+    BOOST_CHECK_EQUAL(board.getAllCurrentlyAvailableMoves().size(), g_MAX_LEGAL_MOVES);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
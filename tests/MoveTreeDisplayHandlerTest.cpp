@@ -218,4 +218,69 @@ BOOST_AUTO_TEST_CASE(TestCastling)
     BOOST_CHECK_EQUAL(getDisplayedGeneratedMoves(PGNString), expectedString);
 }
 
+BOOST_AUTO_TEST_CASE(TestNotationFromTheTree)
+{
+    // Both white knights can reach d2, then both black knights d7
+    const std::string PGNString = "1. Nf3 d5 2. d4 Nf6 3. Nbd2 Nbd7 4. e4 dxe4 5. Nxe4 Nxe4";
+    const std::string expectedString = 
+        "===== Printing the generated moves info =====\n"
+        "1.Nf3 d5 2.d4 Nf6 3.Nbd2 Nbd7 4.e4 dxe4 5.Nxe4 Nxe4";
+
+    BOOST_CHECK_EQUAL(getDisplayedGeneratedMoves(PGNString), expectedString);
+
+    // Worked out once, and shared by the moves that read the same
+    MoveTree::Iterator it = m_moveTreeManager.getMoves().begin();
+    for (int i = 0; i < 9; ++i) ++it;
+    const std::string_view whiteCapture = it.getSAN();
+    ++it;
+    BOOST_CHECK_EQUAL(whiteCapture, "Nxe4");
+    BOOST_CHECK(it.getSAN().data() == whiteCapture.data());
+}
+
+BOOST_AUTO_TEST_CASE(TestLayoutIsCached)
+{
+    m_PGNParser.generatedMoveTreeFromPGNSequence("1. e4 e5 2. Nf3 (2. Nc3) 2... Nc6");
+    MoveTreeDisplayHandler handler{m_moveTreeManager.getMoves()};
+
+    const std::vector<MoveInfo>& moveInfos = handler.generateMoveInfo();
+    const size_t revision = handler.getRevision();
+    BOOST_CHECK_EQUAL(moveInfos.size(), 5);
+
+    // Nothing changed in the tree, nothing to lay out
+    BOOST_CHECK(&handler.generateMoveInfo() == &moveInfos);
+    BOOST_CHECK_EQUAL(handler.getRevision(), revision);
+
+    m_moveTreeManager.reset();
+    BOOST_CHECK(handler.generateMoveInfo().empty());
+    BOOST_CHECK_NE(handler.getRevision(), revision);
+}
+
+BOOST_AUTO_TEST_CASE(TestIncrementalLayout)
+{
+    m_PGNParser.generatedMoveTreeFromPGNSequence(
+        "1. e4 e5 2. Nf3 Nc6 (2... d6 3. d4 (3. Bc4 Be7) 3... Nf6) "
+        "3. Bb5 (3. Bc4 Bc5 4. c3) 3... a6 4. Ba4 Nf6 5. O-O Be7");
+    const MoveTree& fullTree = m_moveTreeManager.getMoves();
+    const std::string expectedString = printMoveInfosGet(MoveTreeDisplayHandler{fullTree}.generateMoveInfo());
+
+    // The same moves inserted one at a time, in the order of the arena
+    MoveTree tree;
+    MoveTreeDisplayHandler handler{tree};
+    for (NodeIndex node = 1; node < fullTree.getArenaSize(); ++node)
+    {
+        std::vector<int> path;
+        for (MoveTree::Iterator it(fullTree, node); !it.isAtTheBeginning(); --it) path.push_back(it.getNodeIdxAmongSiblings());
+
+        MoveTree::Iterator it = tree.begin();
+        for (size_t i = path.size() - 1; i > 0; --i) it.goToChild(path[i]);
+        tree.insertNode(fullTree.getMove(node), it);
+
+        BOOST_CHECK_EQUAL(printMoveInfosGet(handler.generateMoveInfo()), printMoveInfosGet(MoveTreeDisplayHandler{tree}.generateMoveInfo()));
+    }
+    BOOST_CHECK_EQUAL(printMoveInfosGet(handler.generateMoveInfo()), expectedString);
+
+    // Only the moves that do not extend the last line need a new layout
+    BOOST_CHECK_LT(handler.getRebuildCount(), handler.getRevision());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
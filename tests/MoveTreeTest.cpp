@@ -26,23 +26,26 @@ namespace
 
 
     void validateCurrentNode(
-        const std::shared_ptr<MoveTreeNode>& currentNode_,
+        const MoveTree::Iterator& currentNode_,
         const std::optional<std::shared_ptr<Move>>& expectedMove_,
         std::optional<int> expectedChildrenCount_,
         const std::optional<std::shared_ptr<Move>>& expectedParentMove_,
         std::optional<int> expectedParentChildrenCount_)
     {
+        MoveTree::Iterator parent = currentNode_;
+        parent.goToParent();
+
         if (expectedMove_.has_value()) {
-            BOOST_CHECK(currentNode_->m_move == expectedMove_.value());
+            BOOST_CHECK(currentNode_.getMove() == expectedMove_.value());
         }
         if (expectedChildrenCount_.has_value()) {
-            BOOST_CHECK(currentNode_->m_children.size() == expectedChildrenCount_.value());
+            BOOST_CHECK(currentNode_.getChildCount() == expectedChildrenCount_.value());
         }
         if (expectedParentMove_.has_value()) {
-            BOOST_CHECK(currentNode_->m_parent->m_move == expectedParentMove_.value());
+            BOOST_CHECK(parent.getMove() == expectedParentMove_.value());
         }
         if (expectedParentChildrenCount_.has_value()) {
-            BOOST_CHECK(currentNode_->m_parent->m_children.size() == expectedParentChildrenCount_.value());
+            BOOST_CHECK(parent.getChildCount() == expectedParentChildrenCount_.value());
         }
     }
 }
@@ -57,7 +60,7 @@ BOOST_AUTO_TEST_CASE(testInsertNewNodeAtBeginning)
     auto move1 = make_shared<Move>("e2e4");
     m_tree.insertNode(move1, m_iterator);
 
-    validateCurrentNode(m_iterator.getCurrentNode(), move1, 0, std::nullopt, std::nullopt);
+    validateCurrentNode(m_iterator, move1, 0, std::nullopt, std::nullopt);
     BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 1); 
 }
 
@@ -71,7 +74,7 @@ BOOST_AUTO_TEST_CASE(testInsertNewNode)
     auto move2 = make_shared<Move>("d7d5");
     m_tree.insertNode(move2, m_iterator);
 
-    validateCurrentNode(m_iterator.getCurrentNode(), move2, 0, move1, 1);
+    validateCurrentNode(m_iterator, move2, 0, move1, 1);
     BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 2); 
 }
 
@@ -86,13 +89,13 @@ BOOST_AUTO_TEST_CASE(testInsertDuplicatedNode)
     m_tree.insertNode(nextMove, m_iterator);
     m_tree.goToPreviousNode(m_iterator);
 
-    BOOST_CHECK(m_iterator.getCurrentNode()->m_move == initialMove);
+    BOOST_CHECK(m_iterator.getMove() == initialMove);
     BOOST_CHECK(m_tree.getNumberOfMoves() == 2);
     
     auto duplicatedMove = make_shared<Move>("d7d5");
     m_tree.insertNode(duplicatedMove, m_iterator);
 
-    validateCurrentNode(m_iterator.getCurrentNode(), nextMove, 0, initialMove, 1);
+    validateCurrentNode(m_iterator, nextMove, 0, initialMove, 1);
     BOOST_CHECK(m_tree.getNumberOfMoves() == 2);
 }
 
@@ -105,13 +108,13 @@ BOOST_AUTO_TEST_CASE(InsertNodeAtGrandParent)
     m_tree.insertNode(secondMove, m_iterator);
     m_tree.insertNode(thirdMove, m_iterator);
 
-    BOOST_CHECK(m_iterator.getCurrentNode()->m_move == thirdMove);
+    BOOST_CHECK(m_iterator.getMove() == thirdMove);
     m_iterator.goToParent();
     m_iterator.goToParent();
     auto newVariation = make_shared<Move>("e7e5");
     m_tree.insertNode(newVariation, m_iterator);
 
-    validateCurrentNode(m_iterator.getCurrentNode(), newVariation, 0, initialMove, 2);
+    validateCurrentNode(m_iterator, newVariation, 0, initialMove, 2);
     BOOST_CHECK(m_tree.getNumberOfMoves() == 4);
 }
 
@@ -125,11 +128,11 @@ BOOST_AUTO_TEST_CASE(GoToNextNode)
     // Go to an existing variation.
     m_iterator.goToParent();
     m_tree.goToNextNode(0, m_iterator);
-    validateCurrentNode(m_iterator.getCurrentNode(), secondMove, std::nullopt, std::nullopt, std::nullopt);
+    validateCurrentNode(m_iterator, secondMove, std::nullopt, std::nullopt, std::nullopt);
 
     // Leaf node, we don't do anything.
     m_tree.goToNextNode(0, m_iterator);
-    validateCurrentNode(m_iterator.getCurrentNode(), secondMove, std::nullopt, std::nullopt, std::nullopt);
+    validateCurrentNode(m_iterator, secondMove, std::nullopt, std::nullopt, std::nullopt);
 }
 
 BOOST_AUTO_TEST_CASE(testGetNumberOfMoves) 
@@ -150,7 +153,7 @@ BOOST_AUTO_TEST_CASE(testGoToPreviousNode)
     m_tree.insertNode(move2, m_iterator);
 
     m_tree.goToPreviousNode(m_iterator);
-    validateCurrentNode(m_iterator.getCurrentNode(), move1, 1, std::nullopt, std::nullopt);
+    validateCurrentNode(m_iterator, move1, 1, std::nullopt, std::nullopt);
 }
 
 BOOST_AUTO_TEST_CASE(testGetNodeLevel)
@@ -174,6 +177,98 @@ BOOST_AUTO_TEST_CASE(testClear)
     m_tree.clear();
 
     BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 0);
+    BOOST_CHECK(m_tree.begin().isAtTheEnd());
+}
+
+BOOST_AUTO_TEST_CASE(testSiblingsKeepTheirOrder)
+{
+    auto e4 = make_shared<Move>("e2e4");
+    auto d4 = make_shared<Move>("d2d4");
+    auto c4 = make_shared<Move>("c2c4");
+    auto e5 = make_shared<Move>("e7e5");
+    m_tree.insertNode(e4, m_iterator);
+    m_tree.insertNode(e5, m_iterator);
+    for (const auto& move: {d4, c4})
+    {
+        m_iterator.reset();
+        m_tree.insertNode(move, m_iterator);
+    }
+
+    // Iterators only hold indices, so they survive the arena growing
+    BOOST_CHECK(m_iterator.getMove() == c4);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeIdxAmongSiblings(), 2);
+    BOOST_CHECK_EQUAL(m_iterator.getNbOfNodesAtCurrentLevel(), 3);
+
+    m_iterator << 2;
+    validateCurrentNode(m_iterator, e4, 1, std::nullopt, 3);
+    ++m_iterator;
+    validateCurrentNode(m_iterator, e5, 0, e4, 1);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeLevel(), 2);
+
+    MoveTree::Iterator it = m_tree.begin();
+    BOOST_CHECK(it.goToGrandChild(0));
+    BOOST_CHECK(it == m_iterator);
+    BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(testPromoteAndDeleteVariation)
+{
+    auto e4 = make_shared<Move>("e2e4");
+    auto d4 = make_shared<Move>("d2d4");
+    auto c4 = make_shared<Move>("c2c4");
+    auto e5 = make_shared<Move>("e7e5");
+    auto d5 = make_shared<Move>("d7d5");
+    m_tree.insertNode(e4, m_iterator);
+    m_tree.insertNode(e5, m_iterator);
+    for (const auto& line: {std::vector{d4, d5}, std::vector{c4}})
+    {
+        m_iterator.reset();
+        for (const auto& move: line) m_tree.insertNode(move, m_iterator);
+    }
+
+    // 1. d4 becomes the main line, 1. e4 and 1. c4 shift down
+    m_iterator.reset();
+    m_iterator.goToChild(1);
+    m_tree.promoteVariation(m_iterator);
+    BOOST_CHECK(m_iterator.getMove() == d4);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeIdxAmongSiblings(), 0);
+    m_iterator.reset();
+    const std::vector<std::shared_ptr<Move>> expected{d4, e4, c4};
+    for (int i = 0; i < 3; ++i)
+    {
+        m_iterator.goToChild(i);
+        BOOST_CHECK(m_iterator.getMove() == expected[i]);
+        BOOST_CHECK_EQUAL(m_iterator.getNodeIdxAmongSiblings(), i);
+        m_iterator.goToParent();
+    }
+
+    // Deleting 1. e4 takes 1... e5 with it
+    m_iterator.goToChild(1);
+    m_tree.deleteVariation(m_iterator);
+    BOOST_CHECK(m_iterator.isAtTheBeginning());
+    BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 3);
+    BOOST_CHECK_EQUAL(m_iterator.getChildCount(), 2);
+    m_iterator.goToChild(1);
+    validateCurrentNode(m_iterator, c4, 0, std::nullopt, 2);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeIdxAmongSiblings(), 1);
+
+    m_iterator << 1;
+    ++m_iterator;
+    validateCurrentNode(m_iterator, d5, 0, d4, 1);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeLevel(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(testNodeLevelOnLongGame)
+{
+    const std::vector<std::string> knightMoves{"g1f3", "g8f6", "f3g1", "f6g8"};
+    for (int i = 0; i < 500; ++i)
+    {
+        // The same moves over and over make a new node each time down the line
+        m_tree.insertNode(std::make_shared<Move>(knightMoves[i % 4]), m_iterator);
+        BOOST_CHECK_EQUAL(m_iterator.getNodeLevel(), i + 1);
+    }
+    BOOST_CHECK_EQUAL(m_tree.getNumberOfMoves(), 500);
+    BOOST_CHECK_EQUAL(m_iterator.getNodeIdxAmongSiblings(), 0);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/PGNChecker.hpp"
+
+#include <sstream>
+
+namespace
+{
+    std::vector<PGNChecker::GameReport> checkAll(const PGNChecker& checker_, std::string_view text_)
+    {
+        std::vector<PGNChecker::GameReport> reports;
+        checker_.checkText(text_, [&reports](const PGNChecker::GameReport& report_) { reports.push_back(report_); });
+        return reports;
+    }
+
+    // Games of different lengths, the n-th one being told apart by its Round tag
+    std::string makeArchive(int gameCount_)
+    {
+        const std::vector<std::string> movetexts{
+            "1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 1-0",
+            "1. d4 d5 (1... Nf6 2. c4 e6) 2. c4 c6 3. Nc3 Nf6 1/2-1/2",
+            "1. e4 c5 2. Nf3 d6 3. d4 cxd4 4. Nxd4 Nf6 5. Nc3 a6 {Najdorf} 0-1",
+            "1. e4 e5 2. Ke3 *"};
+
+        std::string archive;
+        for (int i = 0; i < gameCount_; ++i)
+            archive += "[Event \"Test\"]\n[Round \"" + std::to_string(i + 1) + "\"]\n\n" + movetexts[i % movetexts.size()] + "\n\n";
+        return archive;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PGNCheckerTests)
+
+BOOST_AUTO_TEST_CASE(TestCheckGame)
+{
+    const PGNChecker checker;
+    const std::vector<PGNChecker::GameReport> reports = checkAll(checker,
+        "[Result \"1-0\"]\n\n1. e4 e5 2. Nf3 (2. Nc3 Nf6 (2... Nc6)) Nc6 1-0\n\n"
+        "[FEN \"3r3k/4P3/8/8/8/8/8/4K3 w - - 0 1\"]\n\n1. exd8=Q# 1-0\n\n"
+        "[Result \"0-1\"]\n\n1. e4 e5 2. Ke3 (2. Ke2) Nc6 1-0\n");
+    BOOST_REQUIRE_EQUAL(reports.size(), 3);
+
+    // Variations count as plies too
+    BOOST_CHECK_EQUAL(reports[0].m_index, 1);
+    BOOST_CHECK_EQUAL(reports[0].m_plies, 7);
+    BOOST_CHECK_EQUAL(reports[0].m_result, "1-0");
+    BOOST_CHECK(reports[0].m_errors.empty());
+
+    BOOST_CHECK_EQUAL(reports[1].m_plies, 1);
+    BOOST_CHECK(reports[1].m_errors.empty());
+
+    // The illegal move ends its line but not the variation, then the result differs
+    BOOST_CHECK_EQUAL(reports[2].m_plies, 3);
+    BOOST_REQUIRE_EQUAL(reports[2].m_errors.size(), 2);
+    BOOST_CHECK_EQUAL(reports[2].m_errors[0], "ply 3: illegal or ambiguous move Ke3");
+}
+
+BOOST_AUTO_TEST_CASE(TestMalformedFEN)
+{
+    const PGNChecker checker;
+    const std::vector<PGNChecker::GameReport> reports = checkAll(checker,
+        "[FEN \"garbage\"]\n\n1. e4 *\n\n"
+        "[FEN \"8/8/8/8/8/8/8/8 w - - 0 1\"]\n\n1. e4 *\n\n"
+        "[FEN \"4k3/8/8/8/8/8/8/4K3 x - - 0 1\"]\n\n1. Kd2 *\n\n"
+        "[FEN \"4k3/8/8/8/8/8/8/4K3 w - - 0 1\"]\n\n1. Kd2 *\n\n"
+        "[FEN \"Q6Q/3Q4/1Q4Q1/4Q3/2Q4Q/Q4Q2/pp1Q4/kQQQ1KQ1 w - - 0 1\"]\n\n1. Qa8b8 *\n\n"
+        "[FEN \"8/8/8/8/8/8/8/Kk6 w - - 0 1\"]\n\n1. Kxb1 *\n\n"
+        "[FEN \"4k3/4Q3/8/8/8/8/8/4K3 w - - 0 1\"]\n\n1. Qxe8 *\n");
+    BOOST_REQUIRE_EQUAL(reports.size(), 7);
+
+    // The game is reported and the games after it are still checked
+    BOOST_REQUIRE_EQUAL(reports[0].m_errors.size(), 1);
+    BOOST_CHECK_EQUAL(reports[0].m_errors[0].substr(0, 16), "invalid FEN tag:");
+    BOOST_CHECK_EQUAL(reports[0].m_plies, 0);
+    BOOST_CHECK_EQUAL(reports[1].m_errors[0], "invalid FEN tag: each side needs exactly one king");
+    BOOST_CHECK_EQUAL(reports[2].m_errors[0], "invalid FEN tag: side to move is not 'w' or 'b'");
+    BOOST_CHECK(reports[3].m_errors.empty());
+    BOOST_CHECK_EQUAL(reports[3].m_plies, 1);
+
+    // Laid out correctly, but no game could get there
+    BOOST_CHECK_EQUAL(reports[4].m_errors[0], "invalid FEN tag: more pieces than promotions allow");
+    BOOST_CHECK_EQUAL(reports[5].m_errors[0], "invalid FEN tag: the side not to move is in check");
+    BOOST_CHECK_EQUAL(reports[6].m_errors[0], "invalid FEN tag: the side not to move is in check");
+}
+
+BOOST_AUTO_TEST_CASE(TestSplitIntoChunks)
+{
+    const std::string archive = makeArchive(50);
+    const std::vector<std::string_view> chunks = PGNChecker::splitIntoChunks(archive, 300);
+    BOOST_CHECK_GT(chunks.size(), 5);
+
+    std::string joined;
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        if (i > 0) BOOST_CHECK_EQUAL(chunks[i].substr(0, 7), "[Event ");
+        joined += chunks[i];
+    }
+    BOOST_CHECK(joined == archive);
+
+    BOOST_CHECK_EQUAL(PGNChecker::splitIntoChunks(archive, archive.size()).size(), 1);
+    BOOST_CHECK(PGNChecker::splitIntoChunks("", 300).empty());
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelCheckKeepsFileOrder)
+{
+    const std::string archive = makeArchive(200);
+    const std::vector<PGNChecker::GameReport> expected = checkAll(PGNChecker(1), archive);
+    const std::vector<PGNChecker::GameReport> actual = checkAll(PGNChecker(4, 256), archive);
+
+    BOOST_REQUIRE_EQUAL(actual.size(), 200);
+    BOOST_REQUIRE_EQUAL(expected.size(), 200);
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(actual[i].m_index, i + 1);
+        BOOST_CHECK_EQUAL(actual[i].m_plies, expected[i].m_plies);
+        BOOST_CHECK_EQUAL(actual[i].m_result, expected[i].m_result);
+        BOOST_CHECK_EQUAL(actual[i].m_errors.size(), expected[i].m_errors.size());
+    }
+    BOOST_CHECK_EQUAL(actual[3].m_errors.size(), 1);
+
+    // Streams give the same reports
+    std::istringstream input(archive);
+    size_t streamed = 0;
+    PGNChecker(4).checkStream(input, [&](const PGNChecker::GameReport& report_)
+    {
+        BOOST_CHECK_EQUAL(report_.m_plies, expected[streamed++].m_plies);
+    });
+    BOOST_CHECK_EQUAL(streamed, 200);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
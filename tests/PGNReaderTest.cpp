@@ -0,0 +1,147 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/MappedFile.hpp"
+#include "../include/Utilities/PGNReader.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+    typedef PGNElement::Type Type;
+
+    // Movetext elements of a game, each written back roughly as in the file
+    std::vector<std::string> describe(const PGNGame& game_)
+    {
+        std::vector<std::string> description;
+        for (const auto& element: game_.m_movetext)
+        {
+            switch (element.m_type)
+            {
+                case Type::MOVE: description.push_back(std::string(element.m_text)); break;
+                case Type::COMMENT: description.push_back("{" + std::string(element.m_text) + "}"); break;
+                case Type::NAG: description.push_back("$" + std::string(element.m_text)); break;
+                case Type::VARIATION_START: description.push_back("("); break;
+                case Type::VARIATION_END: description.push_back(")"); break;
+            }
+        }
+        return description;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PGNReaderTests)
+
+BOOST_AUTO_TEST_CASE(TestTagsAndMovetext)
+{
+    std::istringstream input(
+        "[Event \"Casual \\\"blitz\\\"\"]\n"
+        "[White \"Kasparov, Garry\"]\n"
+        "[Result \"1-0\"]\n"
+        "\n"
+        "1. e4 {Best by test} e5 2.Nf3 $1 Nc6 (2... d6 3. d4 (3. Bc4) exd4) ; Philidor\n"
+        "3. Bb5 !? a6 1-0\n");
+    PGNReader reader(input);
+    PGNGame game;
+
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK(game.m_errors.empty());
+    BOOST_CHECK_EQUAL(game.m_tags.size(), 3);
+    BOOST_CHECK_EQUAL(game.getTag("Event"), "Casual \\\"blitz\\\"");
+    BOOST_CHECK_EQUAL(game.getTag("White"), "Kasparov, Garry");
+    BOOST_CHECK_EQUAL(game.getTag("Black"), "");
+    BOOST_CHECK_EQUAL(game.m_result, "1-0");
+
+    const std::vector<std::string> expected{
+        "e4", "{Best by test}", "e5", "Nf3", "$1", "Nc6", "(", "d6", "d4", "(", "Bc4", ")", "exd4", ")", "{ Philidor}",
+        "Bb5", "$!?", "a6"};
+    const std::vector<std::string> actual = describe(game);
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+
+    BOOST_CHECK(!reader.readGame(game));
+    BOOST_CHECK_EQUAL(reader.getGameCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestSeveralGames)
+{
+    // The second game has no termination marker, the third no tags
+    std::istringstream input(
+        "[Event \"One\"]\n\n1. e4 e5 {multi-line\n[not a tag]\ncomment} 1/2-1/2\n\n"
+        "[Event \"Two\"]\n[Result \"*\"]\n\n1. d4\n"
+        "[Event \"Three\"]\n\n% escaped line\n1. c4 0-1\n\n\n");
+    PGNReader reader(input);
+    PGNGame game;
+
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK_EQUAL(game.getTag("Event"), "One");
+    BOOST_CHECK_EQUAL(game.m_movetext.size(), 3);
+    BOOST_CHECK_EQUAL(game.m_movetext[2].m_text, "multi-line\n[not a tag]\ncomment");
+    BOOST_CHECK_EQUAL(game.m_result, "1/2-1/2");
+
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK_EQUAL(game.getTag("Event"), "Two");
+    BOOST_CHECK_EQUAL(game.m_movetext.size(), 1);
+    BOOST_CHECK_EQUAL(game.m_result, "*");
+
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK_EQUAL(game.getTag("Event"), "Three");
+    BOOST_CHECK_EQUAL(game.m_movetext.size(), 1);
+    BOOST_CHECK_EQUAL(game.m_result, "0-1");
+    BOOST_CHECK(game.m_errors.empty());
+
+    BOOST_CHECK(!reader.readGame(game));
+    BOOST_CHECK_EQUAL(reader.getGameCount(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(TestSyntaxErrors)
+{
+    std::istringstream input(
+        "[Event \"Broken\"]\n[Site oops]\n\n1. e4 (1. d4 e5 {open\n"
+        "[Event \"Next\"]\n\n1. e4 ) e5 *\n");
+    PGNReader reader(input);
+    PGNGame game;
+
+    // The unterminated comment ends with the game, the open variation is closed
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK_EQUAL(game.m_tags.size(), 1);
+    BOOST_CHECK_EQUAL(game.m_errors.size(), 3);
+    BOOST_CHECK(game.m_movetext.back().m_type == Type::VARIATION_END);
+    BOOST_CHECK_EQUAL(game.m_result, "*");
+
+    BOOST_REQUIRE(reader.readGame(game));
+    BOOST_CHECK_EQUAL(game.getTag("Event"), "Next");
+    BOOST_CHECK_EQUAL(game.m_errors.size(), 1);
+    BOOST_CHECK_EQUAL(game.m_movetext.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TestMappedFile)
+{
+    const std::string fileName = "PGNReaderTest.pgn";
+    std::ofstream(fileName) << "[Event \"One\"]\n\n1. e4 e5 1-0\n\n[Event \"Two\"]\n\n1. d4 (1. c4) d5 0-1\n";
+
+    {
+        const MappedFile file(fileName);
+        BOOST_REQUIRE(file.isOpen());
+        const std::string_view text = file.getText();
+
+        // The record points into the mapping, nothing is copied
+        PGNReader reader(text);
+        PGNGame game;
+        BOOST_REQUIRE(reader.readGame(game));
+        BOOST_CHECK_EQUAL(game.getTag("Event"), "One");
+        BOOST_CHECK_EQUAL(game.m_result, "1-0");
+        BOOST_CHECK(game.m_movetext[0].m_text.data() >= text.data() && game.m_movetext[0].m_text.data() < text.data() + text.size());
+
+        BOOST_REQUIRE(reader.readGame(game));
+        BOOST_CHECK_EQUAL(game.getTag("Event"), "Two");
+        BOOST_CHECK_EQUAL(game.m_movetext.size(), 5);
+        BOOST_CHECK_EQUAL(game.m_result, "0-1");
+        BOOST_CHECK(!reader.readGame(game));
+    }
+    std::remove(fileName.c_str());
+
+    BOOST_CHECK(!MappedFile("missing.pgn").isOpen());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
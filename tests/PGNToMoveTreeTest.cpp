@@ -243,4 +243,51 @@ BOOST_AUTO_TEST_CASE(TestDeepNestedSubvariations)
     BOOST_CHECK_EQUAL(m_manager.getMoves().printTreeGet(), expectedString);
 }
 
+BOOST_AUTO_TEST_CASE(TestUnderpromotion)
+{
+    Board board("8/P6k/8/8/8/8/8/K7 w - - 0 1");
+    MoveTreeManager manager(board);
+    PGNParser parser(manager);
+    parser.generatedMoveTreeFromPGNSequence("1. a8=N Kg6 2. Nb6");
+
+    const MoveTree& tree = manager.getMoves();
+    const NodeIndex promotion = tree.getNode(MoveTree::g_ROOT).m_firstChild;
+    BOOST_CHECK_EQUAL(tree.getSAN(promotion), "a8=N");
+    BOOST_CHECK(tree.getMove(promotion)->getPromotion() == PieceType::KNIGHT);
+    BOOST_REQUIRE(board.getBoardTile(1, 2));
+    BOOST_CHECK_EQUAL(board.getBoardTile(1, 2)->getType(), PieceType::KNIGHT);
+
+    // Played again from the tree, the pawn becomes a knight again
+    std::vector<Arrow> arrows;
+    manager.goToInitialMove(arrows);
+    manager.goToNextMove(false, 0, arrows);
+    BOOST_REQUIRE(board.getBoardTile(0, 0));
+    BOOST_CHECK_EQUAL(board.getBoardTile(0, 0)->getType(), PieceType::KNIGHT);
+}
+
+BOOST_AUTO_TEST_CASE(TestPositionHistory)
+{
+    const uint64_t initialHash = m_board.hash();
+    m_PGNParser.generatedMoveTreeFromPGNSequence("1. Nf3 Nf6 2. Ng1 Ng8");
+
+    // Back to the initial position, which the history starts with
+    const std::vector<uint64_t>& history = m_manager.getPositionHistory();
+    BOOST_REQUIRE_EQUAL(history.size(), 4);
+    BOOST_CHECK_EQUAL(history.front(), initialHash);
+    BOOST_CHECK_EQUAL(m_board.hash(), initialHash);
+
+    // Going back leaves the position the last hash was taken from
+    const uint64_t beforeLastMove = history.back();
+    std::vector<Arrow> arrows;
+    m_manager.goToPreviousMove(false, arrows);
+    BOOST_CHECK_EQUAL(history.size(), 3);
+    BOOST_CHECK_EQUAL(m_board.hash(), beforeLastMove);
+
+    m_manager.goToInitialMove(arrows);
+    BOOST_CHECK(history.empty());
+    m_manager.goToCurrentMove(arrows);
+    BOOST_CHECK_EQUAL(history.size(), 4);
+    BOOST_CHECK_EQUAL(history.front(), initialHash);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,92 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/PGNTokenizer.hpp"
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    typedef PGNToken::Type Type;
+
+    std::vector<PGNToken> tokenize(std::string_view text_)
+    {
+        std::vector<PGNToken> tokens;
+        PGNTokenizer tokenizer(text_);
+        PGNToken token;
+        while (tokenizer.next(token)) tokens.push_back(token);
+        return tokens;
+    }
+
+    bool isInside(std::string_view view_, std::string_view text_)
+    {
+        return view_.data() >= text_.data() && view_.data() + view_.size() <= text_.data() + text_.size();
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PGNTokenizerTests)
+
+BOOST_AUTO_TEST_CASE(TestTokenTypes)
+{
+    const std::string text = "[Site \"Wijk aan Zee\"]\n1.e4 {Open} e5 2. Nf3 $1 (2. f4 ?! exf4) 2...Nc6 ; rest\n% escaped\n1-0";
+    const std::vector<PGNToken> tokens = tokenize(text);
+
+    const std::vector<Type> expectedTypes{
+        Type::TAG_PAIR, Type::MOVE, Type::COMMENT, Type::MOVE, Type::MOVE, Type::NAG, Type::VARIATION_START,
+        Type::MOVE, Type::NAG, Type::MOVE, Type::VARIATION_END, Type::MOVE, Type::COMMENT, Type::RESULT};
+    BOOST_REQUIRE_EQUAL(tokens.size(), expectedTypes.size());
+    for (size_t i = 0; i < tokens.size(); ++i)
+    {
+        BOOST_CHECK_MESSAGE(tokens[i].m_type == expectedTypes[i], "token " << i << " '" << tokens[i].m_text << "'");
+
+        // Every token is a view into the text
+        BOOST_CHECK(isInside(tokens[i].m_text, text));
+    }
+
+    BOOST_CHECK_EQUAL(tokens[0].m_text, "Site");
+    BOOST_CHECK_EQUAL(tokens[0].m_value, "Wijk aan Zee");
+    BOOST_CHECK_EQUAL(tokens[1].m_text, "e4");
+    BOOST_CHECK_EQUAL(tokens[2].m_text, "Open");
+    BOOST_CHECK_EQUAL(tokens[5].m_text, "1");
+    BOOST_CHECK_EQUAL(tokens[8].m_text, "?!");
+    BOOST_CHECK_EQUAL(tokens[11].m_text, "Nc6");
+    BOOST_CHECK_EQUAL(tokens[12].m_text, " rest");
+    BOOST_CHECK_EQUAL(tokens[13].m_text, "1-0");
+}
+
+BOOST_AUTO_TEST_CASE(TestErrors)
+{
+    const std::vector<PGNToken> tokens = tokenize("[Event]\ne4 } e5 {open\n[Event \"Next\"]");
+    BOOST_REQUIRE_EQUAL(tokens.size(), 6);
+    BOOST_CHECK(tokens[0].m_type == Type::ERROR);
+    BOOST_CHECK_EQUAL(tokens[0].m_text, "malformed tag pair");
+    BOOST_CHECK(tokens[2].m_type == Type::ERROR);
+    BOOST_CHECK(tokens[4].m_type == Type::ERROR);
+    BOOST_CHECK_EQUAL(tokens[4].m_text, "unterminated comment");
+
+    // The open comment stops before the next game
+    BOOST_CHECK(tokens[5].m_type == Type::TAG_PAIR);
+    BOOST_CHECK_EQUAL(tokens[5].m_value, "Next");
+}
+
+BOOST_AUTO_TEST_CASE(TestLargeAnnotatedGame)
+{
+    // Thousands of commented moves, each with a nested variation
+    std::string text;
+    const int moveCount = 20000;
+    for (int i = 1; i <= moveCount; ++i)
+        text += std::to_string(i) + ". Nf3 {comment} (" + std::to_string(i) + ". Nc3 (" + std::to_string(i) + ". d4 $2)) ";
+
+    int moves = 0;
+    int variations = 0;
+    for (const auto& token: tokenize(text))
+    {
+        moves += token.m_type == Type::MOVE;
+        variations += token.m_type == Type::VARIATION_START;
+    }
+    BOOST_CHECK_EQUAL(moves, 3 * moveCount);
+    BOOST_CHECK_EQUAL(variations, 2 * moveCount);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
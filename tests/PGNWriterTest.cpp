@@ -0,0 +1,137 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveTreeManager.hpp"
+#include "../include/Utilities/PGNParser.hpp"
+#include "../include/Utilities/PGNReader.hpp"
+#include "../include/Utilities/PGNWriter.hpp"
+
+#include <sstream>
+
+namespace
+{
+    struct PGNWriterFixture
+    {
+        Board m_board;
+        MoveTreeManager m_manager{m_board};
+        PGNParser m_PGNParser{m_manager};
+    };
+
+    // The movetext written back from pgn_ parsed on a fresh board
+    std::string rewrite(const std::string& pgn_, const std::string& fen_ = "")
+    {
+        Board board = fen_.empty()? Board(): Board(fen_);
+        MoveTreeManager manager(board);
+        PGNParser parser(manager);
+        parser.generatedMoveTreeFromPGNSequence(pgn_);
+
+        PGNWriter writer;
+        if (fen_.empty()) writer.writeGame(manager.getMoves());
+        else writer.writeGame(manager.getMoves(), {{"FEN", fen_}});
+        return writer.getText();
+    }
+}
+
+BOOST_FIXTURE_TEST_SUITE(PGNWriterTests, PGNWriterFixture)
+
+BOOST_AUTO_TEST_CASE(TestWriteVariationsAndComments)
+{
+    m_PGNParser.generatedMoveTreeFromPGNSequence("1. e4 e5 (1... c5 2. Nf3 (2. c3) d6) 2. Nf3 Nc6 3. Bb5 a6");
+    MoveTree& tree = m_manager.getMoves();
+
+    // On e5, so black's move after it needs its number again
+    MoveTree::Iterator it = tree.begin();
+    it.goToChild(0);
+    it.goToChild(0);
+    tree.annotate(it.getIndex()).m_comment = "[%eval 0.30]";
+
+    PGNWriter writer;
+    writer.writeGame(tree, {{"Event", "Test"}, {"White", "Doe, \"J\""}}, "1-0");
+    BOOST_CHECK_EQUAL(writer.getText(),
+        "[Event \"Test\"]\n"
+        "[White \"Doe, \\\"J\\\"\"]\n"
+        "\n"
+        "1. e4 e5 {[%eval 0.30]} (1... c5 2. Nf3 (2. c3) 2... d6) 2. Nf3 Nc6 3. Bb5 a6\n"
+        "1-0\n"
+        "\n");
+    BOOST_CHECK_EQUAL(writer.getGameCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestRoundTrip)
+{
+    // Wrapped as the writer does, move numbers staying with their move
+    const std::string pgn = "1. d4 Nf6 (1... d5 2. c4 (2. Nf3 Nf6 {Quiet} (2... c5)) 2... e6) 2. c4 e6\n"
+                            "3. Nc3 {Nimzo} (3. Nf3 b6) 3... Bb4 4. e3 O-O 5. Bd3 d5 6. cxd5 exd5 *";
+    const std::string written = rewrite(pgn);
+    BOOST_CHECK_EQUAL(written, pgn + "\n\n");
+    BOOST_CHECK_EQUAL(rewrite(written), written);
+}
+
+BOOST_AUTO_TEST_CASE(TestWriteFromFEN)
+{
+    const std::string fen = "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1";
+    BOOST_CHECK_EQUAL(rewrite("1... e5 2. Nf3 (2. f4 exf4) Nc6", fen),
+        "[FEN \"" + fen + "\"]\n\n1... e5 2. Nf3 (2. f4 exf4) 2... Nc6 *\n\n");
+
+    const std::string lateFen = "4k3/8/8/8/8/8/4P3/4K3 w - - 0 40";
+    BOOST_CHECK_EQUAL(rewrite("40. e4 Kd7", lateFen), "[FEN \"" + lateFen + "\"]\n\n40. e4 Kd7 *\n\n");
+}
+
+BOOST_AUTO_TEST_CASE(TestUnderpromotionRoundTrip)
+{
+    const std::string fen = "1r5k/P7/8/8/8/8/8/K7 w - - 0 1";
+    const std::string written = rewrite("1. a8=N (1. axb8=R+ Kh7) 1... Kg7 2. Nb6 (2. Nc7) 2... Rxb6 *", fen);
+    BOOST_CHECK_EQUAL(written, "[FEN \"" + fen + "\"]\n\n1. a8=N (1. axb8=R+ Kh7) 1... Kg7 2. Nb6 (2. Nc7) 2... Rxb6 *\n\n");
+    BOOST_CHECK_EQUAL(rewrite(written, fen), written);
+}
+
+BOOST_AUTO_TEST_CASE(TestLinesAreWrapped)
+{
+    m_PGNParser.generatedMoveTreeFromPGNSequence(
+        "1. Nf3 Nf6 2. Ng1 Ng8 3. Nf3 Nf6 4. Ng1 Ng8 5. Nf3 Nf6 6. Ng1 Ng8 7. Nf3 Nf6 8. Ng1 Ng8 "
+        "9. Nf3 Nf6 10. Ng1 Ng8 11. Nf3 Nf6 12. Ng1 Ng8 13. Nf3 Nf6 14. Ng1 Ng8 15. Nf3 Nf6");
+    MoveTree& tree = m_manager.getMoves();
+    tree.annotate(tree.getNode(MoveTree::g_ROOT).m_firstChild).m_comment = std::string(40, 'x');
+
+    PGNWriter writer;
+    writer.writeGame(tree);
+
+    std::istringstream lines(writer.getText());
+    int lineCount = 0;
+    for (std::string line; std::getline(lines, line); ++lineCount)
+    {
+        BOOST_CHECK_LE(line.size(), PGNWriter::g_MAX_LINE_LENGTH);
+        BOOST_CHECK(line.empty() || line.back() != ' ');
+    }
+    BOOST_CHECK_GT(lineCount, 3);
+    BOOST_CHECK_EQUAL(rewrite(writer.getText()), writer.getText());
+}
+
+BOOST_AUTO_TEST_CASE(TestBatchExport)
+{
+    m_PGNParser.generatedMoveTreeFromPGNSequence("1. e4 e5 (1... c5) 2. Nf3 Nc6");
+
+    // A small capacity makes the writer flush between games
+    std::ostringstream output;
+    {
+        PGNWriter writer(output, 64);
+        for (int i = 0; i < 100; ++i)
+            writer.writeGame(m_manager.getMoves(), {{"Event", "Batch"}, {"Round", std::to_string(i + 1)}});
+        BOOST_CHECK_LT(writer.getText().size(), 64);
+        BOOST_CHECK_EQUAL(writer.getGameCount(), 100);
+    }
+
+    const std::string text = output.str();
+    PGNReader reader(text);
+    PGNGame game;
+    while (reader.readGame(game))
+    {
+        BOOST_CHECK_EQUAL(game.getTag("Round"), std::to_string(reader.getGameCount()));
+        BOOST_CHECK_EQUAL(game.m_movetext.size(), 7);
+        BOOST_CHECK(game.m_errors.empty());
+    }
+    BOOST_CHECK_EQUAL(reader.getGameCount(), 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,7 +24,7 @@ namespace
         const std::shared_ptr<Piece>& pBlackPawn)
     {
         // Generate the en passant moves
-        pPawn->setLastMovedPiece(pBlackPawn);
+        board.setLastMovedPiece(pBlackPawn);
         pBlackPawn->setLastMove(MoveType::INIT_SPECIAL);
         pPawn->generateEnPassantMoves(actualMoves, board, PAWN_DIR);
     }
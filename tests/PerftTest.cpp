@@ -0,0 +1,104 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/Perft.hpp"
+
+namespace
+{
+    // Keeps the suite fast in debug builds, deeper counts are checked with
+    // the perft tool (./Perft --suite)
+    constexpr uint64_t g_MAX_TESTED_NODES = 100000;
+
+    int countMovesOfType(const Board& board_, MoveType moveType_)
+    {
+        int count = 0;
+        for (auto move : board_.getAllCurrentlyAvailableMoves())
+            if (move.getMoveType() == moveType_) ++count;
+        return count;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PerftTests)
+
+BOOST_AUTO_TEST_CASE(TestReferencePositions)
+{
+    for (const auto& reference : perft::getReferencePositions())
+    {
+        const Board board(reference.m_fen);
+        for (size_t depth = 1; depth <= reference.m_nodes.size(); ++depth)
+        {
+            const uint64_t expected = reference.m_nodes[depth - 1];
+            if (expected > g_MAX_TESTED_NODES) break;
+
+            BOOST_CHECK_MESSAGE(perft::countNodes(board.getPosition(), depth) == expected,
+                                reference.m_name << " at depth " << depth);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestDivideSumsToNodeCount)
+{
+    const Board board(perft::getReferencePositions()[1].m_fen);
+    const perft::Divide nodesPerMove = perft::divide(board.getPosition(), 2);
+
+    uint64_t nodes = 0;
+    for (const auto& [move, moveNodes] : nodesPerMove) nodes += moveNodes;
+    BOOST_CHECK_EQUAL(nodesPerMove.size(), 48);
+    BOOST_CHECK_EQUAL(nodes, 2039);
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelCountsMatch)
+{
+    for (const auto& reference : perft::getReferencePositions())
+    {
+        const Board board(reference.m_fen);
+        const perft::Divide expected = perft::divide(board.getPosition(), 3);
+        const perft::Divide actual = perft::divideParallel(board.getPosition(), 3, 4);
+
+        BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+        {
+            BOOST_CHECK(actual[i].first == expected[i].first);
+            BOOST_CHECK_EQUAL(actual[i].second, expected[i].second);
+        }
+        BOOST_CHECK_EQUAL(perft::countNodesParallel(board.getPosition(), 3, 4), reference.m_nodes[2]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestCachedCountsMatch)
+{
+    perft::NodeCountTable table(1 << 12);
+    for (const auto& reference : perft::getReferencePositions())
+    {
+        const Board board(reference.m_fen);
+
+        // The second pass is answered from the table
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            BOOST_CHECK_EQUAL(perft::countNodes(board.getPosition(), 3, table), reference.m_nodes[2]);
+            BOOST_CHECK_EQUAL(perft::countNodesParallel(board.getPosition(), 3, 2, &table), reference.m_nodes[2]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestFENCastlingRights)
+{
+    Board board("r3k2r/8/8/8/8/8/8/R3K2R w Kq - 0 1");
+    BOOST_CHECK_EQUAL(board.getPosition().getCastlingRights(), g_WHITE_KINGSIDE | g_BLACK_QUEENSIDE);
+
+    board.updateAllCurrentlyAvailableMoves();
+    BOOST_CHECK_EQUAL(countMovesOfType(board, MoveType::CASTLE_KINGSIDE), 1);
+    BOOST_CHECK_EQUAL(countMovesOfType(board, MoveType::CASTLE_QUEENSIDE), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestFENEnPassantSquare)
+{
+    Board board("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+    BOOST_CHECK_EQUAL(board.getPosition().getEnPassantSquare(), bitboard::toSquare(5, 2));
+
+    board.updateAllCurrentlyAvailableMoves();
+    BOOST_CHECK_EQUAL(countMovesOfType(board, MoveType::ENPASSANT), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,90 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/Position.hpp"
+#include "BoardPositionsUtil.hpp"
+
+namespace
+{
+    void checkPositionMatchesBoardTiles(Board& board_)
+    {
+        const Position& position = board_.getPosition();
+        for (int rank = 0; rank < 8; ++rank)
+        {
+            for (int file = 0; file < 8; ++file)
+            {
+                const auto& pPiece = board_.getBoardTile(file, rank);
+                const int square = bitboard::toSquare(file, rank);
+
+                BOOST_CHECK_EQUAL(position.isEmpty(square), pPiece == nullptr);
+                if (!pPiece) continue;
+
+                BOOST_CHECK_EQUAL(position.getTeamAt(square), pPiece->getTeam());
+                BOOST_CHECK_EQUAL(position.getTypeAt(square), pPiece->getType());
+                BOOST_CHECK(bitboard::isSet(position.getPieces(pPiece->getTeam(), pPiece->getType()), square));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(PositionTests)
+
+BOOST_AUTO_TEST_CASE(TestDefaultPositionOccupancy)
+{
+    Board board;
+    const Position& position = board.getPosition();
+
+    BOOST_CHECK_EQUAL(bitboard::popCount(position.getOccupancy(Team::WHITE)), 16);
+    BOOST_CHECK_EQUAL(bitboard::popCount(position.getOccupancy(Team::BLACK)), 16);
+    BOOST_CHECK_EQUAL(position.getOccupancy(Team::BLACK), bitboard::g_RANK_8 | (bitboard::g_RANK_8 << 8));
+    BOOST_CHECK_EQUAL(position.getKingSquare(Team::WHITE), bitboard::toSquare(4, 7));
+    BOOST_CHECK_EQUAL(position.getKingSquare(Team::BLACK), bitboard::toSquare(4, 0));
+    checkPositionMatchesBoardTiles(board);
+}
+
+BOOST_AUTO_TEST_CASE(TestFENPositionOccupancy)
+{
+    Board board(testUtil::FEN_SCOTCH_MAINLINE);
+
+    BOOST_CHECK_EQUAL(board.getPosition().getTurn(), Team::BLACK);
+    BOOST_CHECK_EQUAL(board.getPosition().getTypeAt(bitboard::toSquare(3, 4)), PieceType::KNIGHT);
+    checkPositionMatchesBoardTiles(board);
+}
+
+BOOST_AUTO_TEST_CASE(TestBoardTileUpdatesAreMirrored)
+{
+    Board board(testUtil::FEN_FRIED_LIVER_ATTACK_FRITZ);
+
+    // Nxf7, the knight on g5 takes the pawn on f7
+    auto pKnight = board.getBoardTile({'g', 5});
+    board.resetBoardTile(6, 3);
+    board.setBoardTile(5, 1, pKnight);
+    checkPositionMatchesBoardTiles(board);
+    BOOST_CHECK_EQUAL(bitboard::popCount(board.getPosition().getPieces(Team::BLACK, PieceType::PAWN)), 6);
+
+    // Undo it
+    board.resetBoardTile(5, 1);
+    board.setBoardTile(6, 3, pKnight);
+    checkPositionMatchesBoardTiles(board);
+}
+
+BOOST_AUTO_TEST_CASE(TestSquareAttacks)
+{
+    Board board(testUtil::FEN_SCOTCH_MAINLINE);
+    const Position& position = board.getPosition();
+
+    // f2 is covered by the queen on f6 down the open file
+    BOOST_CHECK(position.isSquareAttacked(bitboard::toSquare(5, 6), Team::BLACK));
+    // d4 is hit by the knight on c6, the bishop on c5 and the queen on f6
+    BOOST_CHECK(position.isSquareAttacked(bitboard::toSquare(3, 4), Team::BLACK));
+    // Pawns attack diagonally forward: b2 covers a3, e4 covers f5 together with the knight on d4
+    BOOST_CHECK(position.isSquareAttacked(bitboard::toSquare(0, 5), Team::WHITE));
+    BOOST_CHECK(position.isSquareAttacked(bitboard::toSquare(5, 3), Team::WHITE));
+    // The pawn on h2 blocks the rook on h1 from reaching h4
+    BOOST_CHECK(!position.isSquareAttacked(bitboard::toSquare(7, 4), Team::WHITE));
+    // The bishop on c5 covers a3 and b4 but not a4
+    BOOST_CHECK(!position.isSquareAttacked(bitboard::toSquare(0, 4), Team::BLACK));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
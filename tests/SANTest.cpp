@@ -0,0 +1,134 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveGenerator.hpp"
+#include "../include/Logic/SAN.hpp"
+
+#include <sstream>
+
+namespace
+{
+    std::string parse(const std::string& fen_, const std::string& move_)
+    {
+        const Board board(fen_);
+        std::ostringstream os;
+        os << san::parseMove(board.getPosition(), move_);
+        return os.str();
+    }
+
+    // The SAN of the legal move written move_ in long algebraic notation
+    std::string write(const std::string& fen_, const std::string& move_)
+    {
+        const Board board(fen_);
+        MoveList moves;
+        MoveGenerator(board.getPosition()).generateLegalMoves(moves);
+        for (auto move: moves)
+        {
+            std::ostringstream os;
+            os << move;
+            if (os.str() == move_) return san::toSAN(board.getPosition(), move);
+        }
+        return "";
+    }
+
+    const std::string g_START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+}
+
+BOOST_AUTO_TEST_SUITE(SANTests)
+
+BOOST_AUTO_TEST_CASE(TestPawnAndPieceMoves)
+{
+    BOOST_CHECK_EQUAL(parse(g_START_FEN, "e4"), "e2e4");
+    BOOST_CHECK_EQUAL(parse(g_START_FEN, "Nf3"), "g1f3");
+    BOOST_CHECK_EQUAL(parse(g_START_FEN, "Nf3!?"), "g1f3");
+    BOOST_CHECK_EQUAL(parse("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2", "exd5"), "e4d5");
+}
+
+BOOST_AUTO_TEST_CASE(TestIllegalMovesAreRejected)
+{
+    BOOST_CHECK(san::parseMove(Board(g_START_FEN).getPosition(), "e5").isNull());
+    BOOST_CHECK(san::parseMove(Board(g_START_FEN).getPosition(), "Nd2").isNull());
+    BOOST_CHECK(san::parseMove(Board(g_START_FEN).getPosition(), "O-O").isNull());
+    BOOST_CHECK(san::parseMove(Board(g_START_FEN).getPosition(), "hello").isNull());
+    BOOST_CHECK(san::parseMove(Board(g_START_FEN).getPosition(), "").isNull());
+}
+
+BOOST_AUTO_TEST_CASE(TestDisambiguation)
+{
+    // Knights on b1 and f1 can both reach d2, rooks on a1 and a5 can both reach a3
+    const std::string fen = "4k3/8/8/R7/8/8/8/RN2KN2 w - - 0 1";
+    BOOST_CHECK(san::parseMove(Board(fen).getPosition(), "Nd2").isNull());
+    BOOST_CHECK_EQUAL(parse(fen, "Nbd2"), "b1d2");
+    BOOST_CHECK_EQUAL(parse(fen, "Nfd2+"), "f1d2");
+    BOOST_CHECK(san::parseMove(Board(fen).getPosition(), "Ra3").isNull());
+    BOOST_CHECK_EQUAL(parse(fen, "R1a3"), "a1a3");
+    BOOST_CHECK_EQUAL(parse(fen, "R5a3"), "a5a3");
+}
+
+BOOST_AUTO_TEST_CASE(TestCastlingAndPromotion)
+{
+    const std::string castlingFen = "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1";
+    BOOST_CHECK_EQUAL(parse(castlingFen, "O-O"), "e1g1");
+    BOOST_CHECK_EQUAL(parse(castlingFen, "0-0-0"), "e1c1");
+
+    const std::string promotionFen = "3r3k/4P3/8/8/8/8/8/4K3 w - - 0 1";
+    BOOST_CHECK_EQUAL(parse(promotionFen, "e8=Q+"), "e7e8q");
+    BOOST_CHECK_EQUAL(parse(promotionFen, "e8N"), "e7e8n");
+    BOOST_CHECK_EQUAL(parse(promotionFen, "exd8=R"), "e7d8r");
+    BOOST_CHECK(san::parseMove(Board(promotionFen).getPosition(), "e8").isNull());
+}
+
+BOOST_AUTO_TEST_CASE(TestWriteMoves)
+{
+    BOOST_CHECK_EQUAL(write(g_START_FEN, "e2e4"), "e4");
+    BOOST_CHECK_EQUAL(write(g_START_FEN, "g1f3"), "Nf3");
+    BOOST_CHECK_EQUAL(write("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2", "e4d5"), "exd5");
+    BOOST_CHECK_EQUAL(write("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3", "e5f6"), "exf6");
+
+    const std::string castlingFen = "r3k2r/8/8/8/8/8/8/R3K2R w KQkq - 0 1";
+    BOOST_CHECK_EQUAL(write(castlingFen, "e1g1"), "O-O");
+    BOOST_CHECK_EQUAL(write(castlingFen, "e1c1"), "O-O-O");
+
+    const std::string promotionFen = "3r3k/4P3/8/8/8/8/8/4K3 w - - 0 1";
+    BOOST_CHECK_EQUAL(write(promotionFen, "e7e8q"), "e8=Q+");
+    BOOST_CHECK_EQUAL(write(promotionFen, "e7e8n"), "e8=N");
+    BOOST_CHECK_EQUAL(write(promotionFen, "e7d8r"), "exd8=R+");
+
+    BOOST_CHECK_EQUAL(write("rnbqkbnr/pppp1ppp/8/4p3/6P1/5P2/PPPPP2P/RNBQKBNR b KQkq - 0 2", "d8h4"), "Qh4#");
+}
+
+BOOST_AUTO_TEST_CASE(TestWriteDisambiguation)
+{
+    const std::string fen = "4k3/8/8/R7/8/8/8/RN2KN2 w - - 0 1";
+    BOOST_CHECK_EQUAL(write(fen, "b1d2"), "Nbd2");
+    BOOST_CHECK_EQUAL(write(fen, "f1d2"), "Nfd2");
+    BOOST_CHECK_EQUAL(write(fen, "b1c3"), "Nc3");
+    BOOST_CHECK_EQUAL(write(fen, "a1a3"), "R1a3");
+    BOOST_CHECK_EQUAL(write(fen, "a5a3"), "R5a3");
+
+    // Queens on a1, a3 and c3 can all reach b2
+    const std::string queensFen = "4k3/8/8/8/8/Q1Q5/8/Q3K3 w - - 0 1";
+    BOOST_CHECK_EQUAL(write(queensFen, "a1b2"), "Q1b2");
+    BOOST_CHECK_EQUAL(write(queensFen, "a3b2"), "Qa3b2");
+    BOOST_CHECK_EQUAL(write(queensFen, "c3b2"), "Qcb2");
+}
+
+BOOST_AUTO_TEST_CASE(TestWrittenMovesReadBack)
+{
+    const std::vector<std::string> fens{
+        g_START_FEN,
+        "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+        "4k3/8/8/8/8/Q1Q5/8/Q3K3 w - - 0 1",
+        "3r3k/4P3/8/8/8/8/8/4K3 w - - 0 1"};
+
+    for (const auto& fen: fens)
+    {
+        const Position position = Board(fen).getPosition();
+        MoveList moves;
+        MoveGenerator(position).generateLegalMoves(moves);
+        for (auto move: moves) BOOST_CHECK(san::parseMove(position, san::toSAN(position, move)) == move);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
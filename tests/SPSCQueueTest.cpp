@@ -0,0 +1,53 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/SPSCQueue.hpp"
+
+#include <thread>
+
+BOOST_AUTO_TEST_SUITE(SPSCQueueTests)
+
+BOOST_AUTO_TEST_CASE(TestPushAndPop)
+{
+    SPSCQueue<int, 4> queue;
+    int item = 0;
+    BOOST_CHECK(!queue.tryPop(item));
+
+    for (int i = 0; i < 4; ++i) BOOST_CHECK(queue.tryPush(i));
+    BOOST_CHECK(!queue.tryPush(4)); // Full
+
+    for (int i = 0; i < 4; ++i)
+    {
+        BOOST_CHECK(queue.tryPop(item));
+        BOOST_CHECK_EQUAL(item, i);
+    }
+    BOOST_CHECK(!queue.tryPop(item));
+}
+
+BOOST_AUTO_TEST_CASE(TestItemsCrossThreadsInOrder)
+{
+    constexpr int itemCount = 100000;
+    SPSCQueue<int, 64> queue;
+
+    std::thread producer([&queue]()
+    {
+        for (int i = 0; i < itemCount; ++i)
+        {
+            while (!queue.tryPush(i)) std::this_thread::yield();
+        }
+    });
+
+    bool inOrder = true;
+    int item = 0;
+    for (int expected = 0; expected < itemCount; ++expected)
+    {
+        while (!queue.tryPop(item)) std::this_thread::yield();
+        inOrder = inOrder && item == expected;
+    }
+    producer.join();
+
+    BOOST_CHECK(inOrder);
+    BOOST_CHECK(!queue.tryPop(item));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,175 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Engine/Search.hpp"
+#include "../include/Engine/Evaluation.hpp"
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveGenerator.hpp"
+#include "BoardPositionsUtil.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace
+{
+    constexpr size_t g_TEST_HASH_ENTRIES = 1 << 14;
+
+    std::string toString(CompactMove move_)
+    {
+        std::ostringstream os;
+        os << move_;
+        return os.str();
+    }
+
+    engine::SearchResult searchToDepth(const std::string& fen_, int depth_)
+    {
+        engine::Search search(g_TEST_HASH_ENTRIES);
+        engine::SearchLimits limits;
+        limits.m_depth = depth_;
+        return search.run(Board(fen_).getPosition(), limits);
+    }
+
+    // Every move of the variation must be legal in the position it is played from
+    bool isPlayable(const std::string& fen_, const std::vector<CompactMove>& variation_)
+    {
+        Position position = Board(fen_).getPosition();
+        for (auto move : variation_)
+        {
+            MoveList moves;
+            MoveGenerator(position).generateLegalMoves(moves);
+            if (std::find(moves.begin(), moves.end(), move) == moves.end()) return false;
+            position.makeMove(move);
+        }
+        return true;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(SearchTests)
+
+BOOST_AUTO_TEST_CASE(TestEvaluationIsSymmetric)
+{
+    const Board board(testUtil::FEN_DEFAULT_POSITION);
+    BOOST_CHECK_EQUAL(engine::evaluate(board.getPosition()), 0);
+
+    // A queen up is worth about a queen, whoever is to move
+    const Board queenUp("4k3/8/8/8/8/8/8/3QK3 w - - 0 1");
+    const Board queenUpBlackToMove("4k3/8/8/8/8/8/8/3QK3 b - - 0 1");
+    BOOST_CHECK_GT(engine::evaluate(queenUp.getPosition()), 800);
+    BOOST_CHECK_EQUAL(engine::evaluate(queenUpBlackToMove.getPosition()), -engine::evaluate(queenUp.getPosition()));
+}
+
+BOOST_AUTO_TEST_CASE(TestFindsMateInOne)
+{
+    const std::string backRankMate = "6k1/5ppp/8/8/8/8/5PPP/3R2K1 w - - 0 1";
+    const engine::SearchResult result = searchToDepth(backRankMate, 4);
+
+    BOOST_CHECK_EQUAL(toString(result.m_bestMove), "d1d8");
+    BOOST_CHECK(engine::isMateScore(result.m_score));
+    BOOST_CHECK_EQUAL(result.m_score, engine::g_MATE_SCORE - 1);
+}
+
+BOOST_AUTO_TEST_CASE(TestFindsMateInTwo)
+{
+    // 1. Kb6 Kb8 2. Rh8#
+    const std::string fen = "k7/8/2K5/8/8/8/8/7R w - - 0 1";
+    const engine::SearchResult result = searchToDepth(fen, 5);
+
+    BOOST_CHECK_EQUAL(result.m_score, engine::g_MATE_SCORE - 3);
+    BOOST_CHECK_EQUAL(result.m_principalVariation.size(), 3);
+    BOOST_CHECK(isPlayable(fen, result.m_principalVariation));
+}
+
+BOOST_AUTO_TEST_CASE(TestWinsHangingQueen)
+{
+    const std::string fen = "rnb1kbnr/pppp1ppp/8/4p1q1/3PP3/8/PPP2PPP/RNBQKBNR w KQkq - 1 3";
+    const engine::SearchResult result = searchToDepth(fen, 4);
+
+    BOOST_CHECK_EQUAL(toString(result.m_bestMove), "c1g5");
+    BOOST_CHECK_GT(result.m_score, 500);
+    BOOST_CHECK(isPlayable(fen, result.m_principalVariation));
+}
+
+BOOST_AUTO_TEST_CASE(TestNoLegalMove)
+{
+    const engine::SearchResult stalemate = searchToDepth(testUtil::FEN_STALEMATE_POSITION, 3);
+    BOOST_CHECK(stalemate.m_bestMove.isNull());
+    BOOST_CHECK_EQUAL(stalemate.m_score, 0);
+}
+
+BOOST_AUTO_TEST_CASE(TestLimitsAndDeterminism)
+{
+    engine::Search search(g_TEST_HASH_ENTRIES);
+    engine::SearchLimits limits;
+    limits.m_nodes = 20000;
+
+    const Board board(testUtil::FEN_FRIED_LIVER_ATTACK_FRITZ);
+    const engine::SearchResult first = search.run(board.getPosition(), limits);
+    BOOST_CHECK_GE(first.m_depth, 1);
+    BOOST_CHECK_LE(first.m_nodes, limits.m_nodes);
+    BOOST_CHECK(!first.m_bestMove.isNull());
+
+    // Starting over from an empty table gives the same answer
+    search.clear();
+    const engine::SearchResult second = search.run(board.getPosition(), limits);
+    BOOST_CHECK(first.m_bestMove == second.m_bestMove);
+    BOOST_CHECK_EQUAL(first.m_score, second.m_score);
+    BOOST_CHECK_EQUAL(first.m_nodes, second.m_nodes);
+}
+
+BOOST_AUTO_TEST_CASE(TestIterationsAreReported)
+{
+    engine::Search search(g_TEST_HASH_ENTRIES);
+    engine::SearchLimits limits;
+    limits.m_depth = 4;
+
+    std::vector<int> depths;
+    search.run(Board(testUtil::FEN_DEFAULT_POSITION).getPosition(), limits,
+               {}, [&depths](const engine::SearchResult& result_) { depths.push_back(result_.m_depth); });
+
+    const std::vector<int> expected{1, 2, 3, 4};
+    BOOST_CHECK_EQUAL_COLLECTIONS(depths.begin(), depths.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(TestRepetitionIsADraw)
+{
+    // Taking the queen wins, unless the position after it already occurred in the game
+    const std::string fen = "3q3k/8/8/8/8/8/8/K2Q4 w - - 0 1";
+    const engine::SearchResult winning = searchToDepth(fen, 3);
+    BOOST_CHECK_EQUAL(toString(winning.m_bestMove), "d1d8");
+    BOOST_CHECK_GT(winning.m_score, 800);
+
+    Position afterCapture = Board(fen).getPosition();
+    afterCapture.makeMove(winning.m_bestMove);
+
+    engine::Search search(g_TEST_HASH_ENTRIES);
+    engine::SearchLimits limits;
+    limits.m_depth = 3;
+    const engine::SearchResult repeated = search.run(Board(fen).getPosition(), limits, {afterCapture.getHash()});
+    BOOST_CHECK_LT(std::abs(repeated.m_score), 200);
+}
+
+BOOST_AUTO_TEST_CASE(TestParallelSearch)
+{
+    engine::Search search(g_TEST_HASH_ENTRIES, 4);
+    BOOST_CHECK_EQUAL(search.getThreadCount(), 4);
+
+    engine::SearchLimits limits;
+    limits.m_depth = 5;
+    const std::string mateInTwo = "k7/8/2K5/8/8/8/8/7R w - - 0 1";
+    const engine::SearchResult mate = search.run(Board(mateInTwo).getPosition(), limits);
+    BOOST_CHECK_EQUAL(mate.m_score, engine::g_MATE_SCORE - 3);
+    BOOST_CHECK(isPlayable(mateInTwo, mate.m_principalVariation));
+
+    // The helpers stop with the main thread, whichever limit it hits
+    limits = engine::SearchLimits();
+    limits.m_time = std::chrono::milliseconds(50);
+    const std::string fen = testUtil::FEN_FRIED_LIVER_ATTACK_FRITZ;
+    const engine::SearchResult timed = search.run(Board(fen).getPosition(), limits);
+    BOOST_CHECK_GE(timed.m_depth, 1);
+    BOOST_CHECK(isPlayable(fen, timed.m_principalVariation));
+
+    search.setThreadCount(1);
+    BOOST_CHECK_EQUAL(search.getThreadCount(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
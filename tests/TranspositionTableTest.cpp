@@ -0,0 +1,69 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/TranspositionTable.hpp"
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // Several words, so that a torn read would show as a mismatch
+    typedef std::array<uint64_t, 4> Payload;
+
+    Payload payloadFor(uint64_t key_) { return {key_, ~key_, key_ * 3, key_ + 7}; }
+}
+
+BOOST_AUTO_TEST_SUITE(TranspositionTableTests)
+
+BOOST_AUTO_TEST_CASE(TestProbeAndStore)
+{
+    TranspositionTable<uint64_t> table(1000);
+    BOOST_CHECK_EQUAL(table.getSize(), 512);
+
+    uint64_t value = 0;
+    BOOST_CHECK(!table.probe(0, value)); // Never written slots are misses, even for key 0
+    BOOST_CHECK(!table.probe(42, value));
+
+    table.store(42, 1234);
+    BOOST_CHECK(table.probe(42, value));
+    BOOST_CHECK_EQUAL(value, 1234);
+
+    // Same slot, other key: the newest value replaces the old one
+    table.store(42 + 512, 99);
+    BOOST_CHECK(!table.probe(42, value));
+    BOOST_CHECK(table.probe(42 + 512, value));
+    BOOST_CHECK_EQUAL(value, 99);
+
+    table.clear();
+    BOOST_CHECK(!table.probe(42 + 512, value));
+}
+
+BOOST_AUTO_TEST_CASE(TestConcurrentAccessNeverTears)
+{
+    TranspositionTable<Payload> table(64);
+    std::atomic<bool> mismatch{false};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&table, &mismatch, t] {
+            for (uint64_t i = 0; i < 20000; ++i)
+            {
+                const uint64_t key = (i * 4 + t) % 256 + 1;
+                table.store(key, payloadFor(key));
+
+                Payload payload;
+                const uint64_t probedKey = (i * 7 + t) % 256 + 1;
+                if (table.probe(probedKey, payload) && payload != payloadFor(probedKey)) mismatch = true;
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    BOOST_CHECK(!mismatch);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
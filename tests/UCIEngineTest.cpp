@@ -0,0 +1,114 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/UCIEngine.hpp"
+#include "BoardPositionsUtil.hpp"
+
+#include <thread>
+
+namespace
+{
+    const std::string g_FAKE_ENGINE_SCRIPT = "tests/FakeUCIEngine.py";
+}
+
+BOOST_AUTO_TEST_SUITE(UCIEngineTests)
+
+BOOST_AUTO_TEST_CASE(TestParseInfoLine)
+{
+    const UCIInfo info = parseUCIInfo(
+        "info depth 18 seldepth 27 multipv 2 score mate -3 upperbound nodes 123456 nps 987654 "
+        "hashfull 412 tbhits 0 time 125 pv e7e8q d2d1n g1f3");
+    BOOST_CHECK_EQUAL(info.m_depth, 18);
+    BOOST_CHECK_EQUAL(info.m_selectiveDepth, 27);
+    BOOST_CHECK_EQUAL(info.m_multiPV, 2);
+    BOOST_CHECK(!info.m_centipawns);
+    BOOST_REQUIRE(info.m_mate);
+    BOOST_CHECK_EQUAL(*info.m_mate, -3);
+    BOOST_CHECK(info.m_isUpperBound && !info.m_isLowerBound);
+    BOOST_CHECK_EQUAL(info.m_nodes, 123456);
+    BOOST_CHECK_EQUAL(info.m_nodesPerSecond, 987654);
+    BOOST_CHECK_EQUAL(info.m_hashFull, 412);
+    BOOST_CHECK_EQUAL(info.m_time.count(), 125);
+
+    const std::vector<std::string> expected{"e7e8q", "d2d1n", "g1f3"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(info.m_principalVariation.begin(), info.m_principalVariation.end(),
+                                  expected.begin(), expected.end());
+
+    const UCIInfo text = parseUCIInfo("info string NNUE evaluation enabled");
+    BOOST_CHECK_EQUAL(text.m_string, "NNUE evaluation enabled");
+
+    const UCIInfo current = parseUCIInfo("info depth 5 currmove e2e4 currmovenumber 1 score cp -12");
+    BOOST_CHECK_EQUAL(current.m_currentMove, "e2e4");
+    BOOST_REQUIRE(current.m_centipawns);
+    BOOST_CHECK_EQUAL(*current.m_centipawns, -12);
+}
+
+BOOST_AUTO_TEST_CASE(TestSearchSession)
+{
+    UCIEngine engine("python3", {g_FAKE_ENGINE_SCRIPT});
+    BOOST_REQUIRE(engine.start());
+    BOOST_CHECK_EQUAL(engine.getName(), "Fake Engine");
+    const std::vector<std::string> options{"Hash", "Threads", "MultiPV"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(engine.getOptionNames().begin(), engine.getOptionNames().end(), options.begin(), options.end());
+
+    engine.setOption("Hash", "64");
+    engine.setOption("Threads", "2");
+    engine.setOption("MultiPV", "2");
+    engine.newGame();
+    BOOST_CHECK(engine.isReady());
+
+    engine.setPosition(testUtil::FEN_DEFAULT_POSITION, {"e2e4"});
+    std::vector<UCIInfo> infos;
+    UCIGoLimits limits;
+    limits.m_depth = 3;
+    limits.m_moveTime = std::chrono::milliseconds(100);
+    engine.go(limits, [&infos](const UCIInfo& info_) { infos.push_back(info_); });
+    BOOST_CHECK(engine.isSearching());
+
+    const auto bestMove = engine.waitForBestMove(std::chrono::seconds(10));
+    BOOST_REQUIRE(bestMove);
+    BOOST_CHECK_EQUAL(bestMove->m_move, "e7e8q"); // Promotions are kept whole
+    BOOST_CHECK_EQUAL(bestMove->m_ponder, "d2d1n");
+    BOOST_CHECK(!engine.isSearching());
+
+    // The echoed settings, then one line per depth and variation
+    BOOST_REQUIRE_EQUAL(infos.size(), 1 + 3 * 2);
+    BOOST_CHECK_EQUAL(infos[0].m_string, "Hash=64 MultiPV=2 Threads=2 position fen " + testUtil::FEN_DEFAULT_POSITION + " moves e2e4");
+    BOOST_CHECK_EQUAL(infos.back().m_depth, 3);
+    BOOST_CHECK_EQUAL(infos.back().m_multiPV, 2);
+    BOOST_CHECK_EQUAL(infos.back().m_principalVariation.size(), 2);
+
+    engine.quit();
+    BOOST_CHECK(!engine.isRunning());
+}
+
+BOOST_AUTO_TEST_CASE(TestInfiniteSearchStops)
+{
+    UCIEngine engine("python3", {g_FAKE_ENGINE_SCRIPT});
+    BOOST_REQUIRE(engine.start());
+
+    engine.setStartPosition();
+    int infoCount = 0;
+    UCIGoLimits limits;
+    limits.m_infinite = true;
+    engine.go(limits, [&infoCount](const UCIInfo&) { ++infoCount; });
+
+    // Polling never waits for the engine
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    BOOST_CHECK(!engine.poll());
+    BOOST_CHECK_GT(infoCount, 0);
+
+    engine.stop();
+    const auto bestMove = engine.waitForBestMove(std::chrono::seconds(10));
+    BOOST_REQUIRE(bestMove);
+    BOOST_CHECK_EQUAL(bestMove->m_move, "e2e4");
+}
+
+BOOST_AUTO_TEST_CASE(TestMissingEngine)
+{
+    UCIEngine engine("./no-such-engine");
+    BOOST_CHECK(!engine.start(std::chrono::seconds(5)));
+    BOOST_CHECK(!engine.isRunning());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,33 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Utilities/WorkStealingPool.hpp"
+
+#include <atomic>
+
+BOOST_AUTO_TEST_SUITE(WorkStealingPoolTests)
+
+BOOST_AUTO_TEST_CASE(TestEveryTaskRuns)
+{
+    WorkStealingPool pool(4);
+    BOOST_CHECK_EQUAL(pool.getThreadCount(), 4);
+
+    // Tasks submitting more tasks from the workers are waited for as well
+    std::atomic<int> count{0};
+    for (int i = 0; i < 100; ++i)
+    {
+        pool.submit([&pool, &count] {
+            ++count;
+            pool.submit([&count] { ++count; });
+        });
+    }
+    pool.wait();
+    BOOST_CHECK_EQUAL(count.load(), 200);
+
+    // The pool can be reused once idle
+    pool.submit([&count] { ++count; });
+    pool.wait();
+    BOOST_CHECK_EQUAL(count.load(), 201);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,100 @@
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/MoveTreeManager.hpp"
+#include "../include/Logic/MoveGenerator.hpp"
+#include "../include/Utilities/PGNParser.hpp"
+#include "BoardPositionsUtil.hpp"
+
+namespace
+{
+    struct ZobristFixture
+    {
+        Board m_board;
+        MoveTreeManager m_manager{m_board};
+        PGNParser m_PGNParser{m_manager};
+        std::vector<Arrow> m_arrows;
+    };
+
+    uint64_t hashAfter(const std::string& pgn_)
+    {
+        ZobristFixture fixture;
+        fixture.m_PGNParser.generatedMoveTreeFromPGNSequence(pgn_);
+        return fixture.m_board.hash();
+    }
+}
+
+BOOST_FIXTURE_TEST_SUITE(ZobristTests, ZobristFixture)
+
+BOOST_AUTO_TEST_CASE(TestInitialPositionMatchesFEN)
+{
+    BOOST_CHECK_EQUAL(m_board.hash(), Board(testUtil::FEN_DEFAULT_POSITION).hash());
+    BOOST_CHECK_EQUAL(m_board.hash(), m_board.getPosition().computeHash());
+}
+
+BOOST_AUTO_TEST_CASE(TestTranspositionsShareTheHash)
+{
+    const uint64_t hash = hashAfter("1. Nf3 Nf6 2. Nc3");
+    BOOST_CHECK_EQUAL(hash, hashAfter("1. Nc3 Nf6 2. Nf3"));
+    BOOST_CHECK_EQUAL(hash, Board("rnbqkb1r/pppppppp/5n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R b KQkq - 3 2").hash());
+
+    // Same pieces, other side to move
+    BOOST_CHECK_NE(hash, Board("rnbqkb1r/pppppppp/5n2/8/8/2N2N2/PPPPPPPP/R1BQKB1R w KQkq - 3 2").hash());
+}
+
+BOOST_AUTO_TEST_CASE(TestNavigationRestoresTheHash)
+{
+    const uint64_t initialHash = m_board.hash();
+    m_PGNParser.generatedMoveTreeFromPGNSequence("1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 4. O-O Nf6 5. d4 exd4");
+    const uint64_t finalHash = m_board.hash();
+    BOOST_CHECK_EQUAL(finalHash, hashAfter("1. e4 e5 2. Nf3 Nc6 3. Bb5 a6 4. O-O Nf6 5. d4 exd4"));
+
+    m_manager.goToInitialMove(m_arrows);
+    BOOST_CHECK_EQUAL(m_board.hash(), initialHash);
+
+    m_manager.goToCurrentMove(m_arrows);
+    BOOST_CHECK_EQUAL(m_board.hash(), finalHash);
+}
+
+BOOST_AUTO_TEST_CASE(TestEnPassantSquareOnlyCountsWhenCapturable)
+{
+    // No black pawn can take on e3
+    BOOST_CHECK_EQUAL(hashAfter("1. e4"),
+        Board("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq - 0 1").hash());
+
+    // The pawn on f5 can take on e3
+    const uint64_t capturable = hashAfter("1. Nf3 f5 2. Ng1 f4 3. e4");
+    BOOST_CHECK_EQUAL(capturable,
+        Board("rnbqkbnr/ppppp1pp/8/8/4Pp2/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 3").hash());
+    BOOST_CHECK_NE(capturable,
+        Board("rnbqkbnr/ppppp1pp/8/8/4Pp2/8/PPPP1PPP/RNBQKBNR b KQkq - 0 3").hash());
+}
+
+BOOST_AUTO_TEST_CASE(TestMakeMoveUpdatesTheHash)
+{
+    // Every move of Kiwipete and of its replies, castling, en passant and
+    // promotions included, against a full recompute
+    const Board board("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1");
+
+    MoveList moves;
+    MoveGenerator(board.getPosition()).generateLegalMoves(moves);
+    for (auto move : moves)
+    {
+        Position child = board.getPosition();
+        child.makeMove(move);
+        BOOST_CHECK_EQUAL(child.getHash(), child.computeHash());
+        BOOST_CHECK_NE(child.getHash(), board.getPosition().getHash());
+
+        MoveList replies;
+        MoveGenerator(child).generateLegalMoves(replies);
+        for (auto reply : replies)
+        {
+            Position grandChild = child;
+            grandChild.makeMove(reply);
+            BOOST_CHECK_EQUAL(grandChild.getHash(), grandChild.computeHash());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,103 @@
+#include "../include/Utilities/MappedFile.hpp"
+#include "../include/Utilities/PGNChecker.hpp"
+#include "../include/Utilities/WorkStealingPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Headless PGN checker, built with `make pgnbatch`:
+//   ./PGNBatch [--quiet] [--threads N] <file.pgn>...     "-" reads the standard input
+// Replays every game of the files, variations included, through the legal
+// move generator (see PGNChecker). Prints the plies, result and parse errors
+// of each game, in file order (only the totals with --quiet), then the
+// throughput. The thread count defaults to the number of hardware threads.
+// Exits with 1 if any game has an error.
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct Totals
+    {
+        size_t m_games = 0;
+        size_t m_plies = 0;
+        size_t m_gamesWithErrors = 0;
+    };
+
+    // Files are memory-mapped and read without copying, "-" stands for the
+    // standard input, read as a stream
+    bool processFile(const std::string& fileName_, const PGNChecker& checker_, bool isQuiet_, Totals& totals_)
+    {
+        auto onReport = [&](const PGNChecker::GameReport& report_)
+        {
+            ++totals_.m_games;
+            totals_.m_plies += report_.m_plies;
+            if (!report_.m_errors.empty()) ++totals_.m_gamesWithErrors;
+
+            if (!isQuiet_)
+            {
+                std::cout << fileName_ << " #" << report_.m_index << ": " << report_.m_plies << " plies, "
+                          << report_.m_result << ", " << report_.m_errors.size() << " errors\n";
+                for (const auto& error: report_.m_errors) std::cout << "  " << error << '\n';
+            }
+        };
+
+        if (fileName_ == "-")
+        {
+            checker_.checkStream(std::cin, onReport);
+            return true;
+        }
+
+        const MappedFile file(fileName_);
+        if (!file.isOpen())
+        {
+            std::cerr << fileName_ << ": unable to open file\n";
+            return false;
+        }
+        checker_.checkText(file.getText(), onReport);
+        return true;
+    }
+
+    void printUsage(const char* program_)
+    {
+        std::cerr << "Usage: " << program_ << " [--quiet] [--threads N] <file.pgn>...\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool isQuiet = false;
+    unsigned threadCount = WorkStealingPool::getDefaultThreadCount();
+    std::vector<std::string> fileNames;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        if (argument == "--quiet") isQuiet = true;
+        else if (argument == "--threads" && i + 1 < argc) threadCount = std::max(std::atoi(argv[++i]), 1);
+        else fileNames.push_back(argument);
+    }
+    if (fileNames.empty())
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    const PGNChecker checker(threadCount);
+    const auto start = Clock::now();
+
+    Totals totals;
+    bool allRead = true;
+    for (const auto& fileName: fileNames) allRead = processFile(fileName, checker, isQuiet, totals) && allRead;
+
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    std::cout << "\nGames: " << totals.m_games << " (" << totals.m_gamesWithErrors << " with errors)\n";
+    std::cout << "Plies: " << totals.m_plies << '\n';
+    std::cout << "Threads: " << checker.getThreadCount() << '\n';
+    std::cout << "Time: " << static_cast<long long>(seconds * 1000) << " ms\n";
+    std::cout << "Games/second: " << static_cast<uint64_t>(seconds > 0? totals.m_games / seconds: 0) << '\n';
+    std::cout << "Plies/second: " << static_cast<uint64_t>(seconds > 0? totals.m_plies / seconds: 0) << '\n';
+    return (allRead && totals.m_gamesWithErrors == 0)? 0: 1;
+}
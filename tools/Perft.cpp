@@ -0,0 +1,135 @@
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/Perft.hpp"
+#include "../include/Utilities/WorkStealingPool.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Command line front end of perft, built with `make perft`:
+//   ./Perft [--hash] "<fen>" <depth> [threads]     node count of each root move, total and speed
+//   ./Perft [--hash] --suite [depth] [threads]     checks the reference positions up to depth (default 4)
+// The thread count defaults to the number of hardware threads. With --hash,
+// subtree counts are cached in a table shared by the threads for the whole
+// run; the speed then reflects table hits, so leave it off when timing move
+// generation.
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    constexpr int g_DEFAULT_SUITE_DEPTH = 4;
+    constexpr size_t g_NODE_COUNT_TABLE_ENTRIES = 1 << 21; // 48 MB
+
+    void printSpeed(uint64_t nodes_, Clock::duration elapsed_)
+    {
+        const double seconds = std::chrono::duration<double>(elapsed_).count();
+        std::cout << "Time: " << static_cast<long long>(seconds * 1000) << " ms\n";
+        std::cout << "Nodes/second: " << static_cast<uint64_t>(seconds > 0? nodes_ / seconds: 0) << '\n';
+    }
+
+    int runDivide(const std::string& fen_, int depth_, unsigned threadCount_, perft::NodeCountTable* pNodeCountTable_)
+    {
+        // A mistyped FEN must not pass for a position without moves
+        const std::string problem = Board::checkFEN(fen_);
+        if (!problem.empty())
+        {
+            std::cerr << "Invalid FEN: " << problem << '\n';
+            return 2;
+        }
+        const Board board(fen_);
+
+        const auto start = Clock::now();
+        const perft::Divide nodesPerMove = perft::divideParallel(board.getPosition(), depth_, threadCount_, pNodeCountTable_);
+        const auto elapsed = Clock::now() - start;
+
+        uint64_t nodes = 0;
+        for (const auto& [move, moveNodes]: nodesPerMove)
+        {
+            std::cout << move << ": " << moveNodes << '\n';
+            nodes += moveNodes;
+        }
+
+        std::cout << "\nMoves: " << nodesPerMove.size() << '\n';
+        std::cout << "Nodes: " << nodes << '\n';
+        std::cout << "Threads: " << threadCount_ << '\n';
+        std::cout << "Hash: " << (pNodeCountTable_? "on": "off") << '\n';
+        printSpeed(nodes, elapsed);
+        return 0;
+    }
+
+    int runSuite(int maxDepth_, unsigned threadCount_, perft::NodeCountTable* pNodeCountTable_)
+    {
+        bool allPassed = true;
+        uint64_t totalNodes = 0;
+        const auto start = Clock::now();
+
+        for (const auto& reference: perft::getReferencePositions())
+        {
+            std::cout << reference.m_name << " (" << reference.m_fen << ")\n";
+            const Board board(reference.m_fen);
+
+            for (int depth = 1; depth <= maxDepth_ && depth <= static_cast<int>(reference.m_nodes.size()); ++depth)
+            {
+                const uint64_t nodes = perft::countNodesParallel(board.getPosition(), depth, threadCount_, pNodeCountTable_);
+                const uint64_t expected = reference.m_nodes[depth - 1];
+                totalNodes += nodes;
+
+                std::cout << "  depth " << depth << ": " << nodes;
+                if (nodes == expected) std::cout << " ok\n";
+                else std::cout << " FAILED, expected " << expected << '\n';
+                allPassed = allPassed && nodes == expected;
+            }
+        }
+
+        std::cout << '\n' << (allPassed? "All reference counts match": "Some reference counts differ") << '\n';
+        std::cout << "Nodes: " << totalNodes << '\n';
+        std::cout << "Threads: " << threadCount_ << '\n';
+        std::cout << "Hash: " << (pNodeCountTable_? "on": "off") << '\n';
+        printSpeed(totalNodes, Clock::now() - start);
+        return allPassed? 0: 1;
+    }
+
+    void printUsage(const char* program_)
+    {
+        std::cerr << "Usage: " << program_ << " [--hash] \"<fen>\" <depth> [threads]\n"
+                  << "       " << program_ << " [--hash] --suite [depth] [threads]\n";
+    }
+
+    unsigned readThreadCount(const std::vector<std::string>& args_, size_t index_)
+    {
+        const int threadCount = (args_.size() > index_)? std::atoi(args_[index_].c_str()): 0;
+        return (threadCount > 0)? threadCount: WorkStealingPool::getDefaultThreadCount();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    // Positional arguments, the program name first, and the options apart
+    std::vector<std::string> args;
+    bool isHashed = false;
+    for (int i = 0; i < argc; ++i)
+    {
+        if (std::string(argv[i]) == "--hash") isHashed = true;
+        else args.emplace_back(argv[i]);
+    }
+
+    std::optional<perft::NodeCountTable> nodeCountTable;
+    if (isHashed) nodeCountTable.emplace(g_NODE_COUNT_TABLE_ENTRIES);
+    perft::NodeCountTable* pNodeCountTable = nodeCountTable? &*nodeCountTable: nullptr;
+
+    if (args.size() >= 2 && args[1] == "--suite")
+    {
+        const int depth = (args.size() >= 3)? std::atoi(args[2].c_str()): g_DEFAULT_SUITE_DEPTH;
+        return runSuite(depth, readThreadCount(args, 3), pNodeCountTable);
+    }
+
+    if (args.size() < 3 || args.size() > 4 || std::atoi(args[2].c_str()) < 1)
+    {
+        printUsage(argv[0]);
+        return 2;
+    }
+    return runDivide(args[1], std::atoi(args[2].c_str()), readThreadCount(args, 3), pNodeCountTable);
+}
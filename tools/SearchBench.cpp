@@ -0,0 +1,85 @@
+#include "../include/Engine/Search.hpp"
+#include "../include/Logic/Board.hpp"
+#include "../include/Logic/Perft.hpp"
+#include "../include/Utilities/WorkStealingPool.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+// Search benchmark, built with `make bench`:
+//   ./SearchBench [depth] [threads]
+// Searches the perft reference positions to a fixed depth (default 8) with
+// 1, 2, 4... up to the given number of threads (default the number of
+// hardware threads), starting from an empty table every time. For each
+// thread count, prints the speed in nodes per second and the time-to-depth
+// speedup over a single thread.
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    constexpr int g_DEFAULT_DEPTH = 8;
+
+    struct BenchResult
+    {
+        uint64_t m_nodes = 0;
+        double m_seconds = 0;
+    };
+
+    BenchResult runPositions(engine::Search& search_, int depth_)
+    {
+        engine::SearchLimits limits;
+        limits.m_depth = depth_;
+
+        BenchResult total;
+        for (const auto& reference: perft::getReferencePositions())
+        {
+            const Board board(reference.m_fen);
+            search_.clear();
+
+            const auto start = Clock::now();
+            const engine::SearchResult result = search_.run(board.getPosition(), limits);
+            total.m_seconds += std::chrono::duration<double>(Clock::now() - start).count();
+            total.m_nodes += result.m_nodes;
+        }
+        return total;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const int depth = (argc >= 2)? std::atoi(argv[1]): g_DEFAULT_DEPTH;
+    const int maxThreads = (argc >= 3)? std::atoi(argv[2]): static_cast<int>(WorkStealingPool::getDefaultThreadCount());
+    if (argc > 3 || depth < 1 || maxThreads < 1)
+    {
+        std::cerr << "Usage: " << argv[0] << " [depth] [threads]\n";
+        return 2;
+    }
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < static_cast<unsigned>(maxThreads); threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    engine::Search search;
+    double singleThreadSeconds = 0;
+
+    std::cout << "Depth: " << depth << '\n';
+    std::cout << std::setw(8) << "Threads" << std::setw(14) << "Nodes" << std::setw(10) << "Time ms"
+              << std::setw(14) << "Nodes/second" << std::setw(10) << "Speedup" << '\n';
+    for (unsigned threads: threadCounts)
+    {
+        search.setThreadCount(threads);
+        const BenchResult result = runPositions(search, depth);
+        if (threads == 1) singleThreadSeconds = result.m_seconds;
+
+        std::cout << std::setw(8) << threads
+                  << std::setw(14) << result.m_nodes
+                  << std::setw(10) << static_cast<long long>(result.m_seconds * 1000)
+                  << std::setw(14) << static_cast<uint64_t>(result.m_seconds > 0? result.m_nodes / result.m_seconds: 0)
+                  << std::setw(10) << std::fixed << std::setprecision(2)
+                  << (result.m_seconds > 0? singleThreadSeconds / result.m_seconds: 0) << '\n';
+    }
+    return 0;
+}